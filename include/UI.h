@@ -2,8 +2,12 @@
 #define UI_H
 
 #include <constants.h>
+#include <parameterAssigner.h>
+#include <trace.h>
 
 #include <iostream>
+#include <string>
+#include <vector>
 
 #include <GLFW/glfw3.h>
 #include <imgui.h>
@@ -23,6 +27,12 @@ enum Actions
 	MOUSE_ADD_FOOD,
 	ADD_ANT,
 	MOUSE_ADD_ANT,
+	SAVE_SNAPSHOT,
+	LOAD_SNAPSHOT,
+	OPEN_REPLAY,
+	START_EVOLUTION,
+	STOP_EVOLUTION,
+	APPLY_EVOLUTION,
 };
 
 enum StateOfSimulation
@@ -30,6 +40,7 @@ enum StateOfSimulation
 	RUNNING,
 	PAUSED,
 	RESET,
+	REPLAY,
 	CLOSED
 };
 
@@ -64,9 +75,33 @@ class UI
 
     	int nestID;
 
+    	// Snapshot written by "Save experiment" and read by "Load experiment"
+    	char snapshotPath[256];
+
+    	// Trajectory played in the REPLAY state, the context moves replayTick
+    	// with playback and seeks when replaySeek is set
+    	char trajectoryPath[256];
+    	char pheromonePath[256];
+    	bool replayPlaying;
+    	float replaySpeed;
+    	uint64_t replayTick;
+    	uint64_t replayFirstTick;
+    	uint64_t replayLastTick;
+    	bool replaySeek;
+
+    	// Parameters of the next evolution, taken from the experiment, the
+    	// context fills in the progress of the last one every frame, one entry
+    	// per generation evaluated
+    	EvolutionParameters evolutionParameters;
+    	bool evolutionRunning;
+    	vector<float> evolutionBestFitness;
+    	vector<float> evolutionMeanFitness;
+    	string evolutionBest;
+
 		UI();
 
 		void init(GLFWwindow* window);
+		void loadExperiment(ParameterAssigner* parameterAssigner);
 		void pre_render();
 		void render();
 		void post_render();
@@ -76,6 +111,8 @@ class UI
 		void simulationControls();
 		void experimentsTab();
 		void antsRealTimeInteractionsTab();
+		void replayTab();
+		void evolutionaryAlgorithmWindow();
 
 };
 #endif
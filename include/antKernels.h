@@ -0,0 +1,31 @@
+#ifndef ANTKERNELS_H
+#define ANTKERNELS_H
+
+#include <pheromoneMatrix.h>
+#include <sinCosLookup.h>
+#include <cmath>
+
+// Kernels over runs of ants of one species in the FLOAT_ANTS arrays. Every
+// level does the arithmetic of AntSwarm::move and AntSensor::move in the same
+// order, so each level gives the same bits as the scalar one. swarm_bench
+// --filter simdParity checks it and fails on any difference.
+
+// Sine and cosine of count angles in (-2*pi, 4*pi)
+void sinCosKernel(const float* radians, float* sine, float* cosine, int count, TrigMode trigMode, SimdLevel simdLevel);
+
+// One step of count ants along their heading, clamped to the world border
+void moveAntsKernel(float* posX, float* posY, const float* theta, float velocity, int count, TrigMode trigMode, SimdLevel simdLevel);
+
+// Grid cell under one sensor of count ants. halfWidth and halfHeight are half
+// the grid size in cells.
+void placeSensorsKernel(const float* posX, const float* posY, const float* theta, float xCenterAntDistance, float yCenterAntDistance, float positionAngle,
+	float halfWidth, float halfHeight, int* cellX, int* cellY, int count, TrigMode trigMode, SimdLevel simdLevel);
+
+// Box sums around count sensor cells, from the summed area tables of a
+// width x height field. Same values as PheromoneMatrix::boxSums.
+void summedAreaBoxSumsKernel(uint32_t* const* tables, int width, int height, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count, SimdLevel simdLevel);
+
+// Box sums around count sensor cells of an eagerly evaporated RGBA field
+void interleavedBoxSumsKernel(const uint8_t* rgba, int width, int height, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count, SimdLevel simdLevel);
+
+#endif
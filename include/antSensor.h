@@ -2,17 +2,18 @@
 #define SENSOR_H
 
 #include <parameterAssigner.h>
+#include <pheromoneMatrix.h>
 #include <sinCosLookup.h>
+#include <cmath>
 #include <constants.h>
-#include <glm/gtc/matrix_transform.hpp>
 
 using namespace std;
 
+// Sensors are not stored per ant anymore, the geometry lives in the species of
+// the ant and a sensor is placed on the stack only while the ant is sensing
 class AntSensor 
 {
 	public:
-		int id;
-
 		float posX;
 		float posY;
 		float xCenterAntDistance;
@@ -23,10 +24,9 @@ class AntSensor
 		int indexSensorX;
 		int indexSensorY;
 
-		SensorType sensorType;
-
-		AntSensor(int id, AntSensorParameters* antSensorParameters);
-		int detectPheromone(uint8_t* pheromoneMatrix, PheromoneType pheromoneType);
-		void move(float antPosX, float antPosy, float theta);
+		AntSensor(float xCenterAntDistance, float yCenterAntDistance, float positionAngle, int sensorPixelRadius);
+		int detectPheromone(PheromoneMatrix* pheromoneMatrix, PheromoneType pheromoneType);
+		PheromoneReading detectPheromones(PheromoneMatrix* pheromoneMatrix);
+		void move(float antPosX, float antPosy, float theta, TrigMode trigMode);
 };
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,294 @@
+#ifndef ANTSWARM_H
+#define ANTSWARM_H
+
+#include <sinCosLookup.h>
+#include <counterRandom.h>
+
+#include <foodSource.h>
+#include <anthill.h>
+#include <antSensor.h>
+#include <landmarkIndex.h>
+#include <antKernels.h>
+
+#include <parameterAssigner.h>
+
+using namespace std;
+
+// Alignment of every ant array, one cache line
+#define ANT_ARRAY_ALIGNMENT 64
+
+// Compact positions are 16 bit fixed point over the world square [-1, 1],
+// about 1/32 of a cell of a 2000 cell grid and a whole cell at 65536 cells
+#define FIXED_POSITION_ONE 32768.0f
+#define FIXED_POSITION_MAX_CELLS 65536
+
+// Compact headings are steps of the sin/cos tables
+#define HEADING_STEPS TRIG_TABLE_STEPS
+
+// Compact flags: state in bits 0-2, pheromoneType + 1 in bits 3-5 and
+// carryingFood in bit 6
+#define FLAGS_STATE_MASK 0x07
+#define FLAGS_PHEROMONE_SHIFT 3
+#define FLAGS_PHEROMONE_MASK 0x38
+#define FLAGS_CARRYING_FOOD 0x40
+
+// Ants of one species handed to the SIMD kernels at a time by stepRange
+#define ANT_KERNEL_BATCH 256
+
+// State argument of step for ants of any state, their decision goes through
+// the switch of makeDecision
+#define ANY_ANT_STATE NUMBER_OF_ANT_STATES
+
+enum AntSensorSide
+{
+	SENSOR_RIGHT,
+	SENSOR_LEFT,
+	SENSORS_PER_ANT
+};
+
+// What every ant of one species shares, kept once instead of once per ant
+typedef struct
+{
+	AntParameters* antParameters;
+	int nestID;
+	float size;
+	float velocity;
+	int viewFrequency;
+
+	// Sensor geometry, indexed by AntSensorSide
+	float sensorXCenterAntDistance[SENSORS_PER_ANT];
+	float sensorYCenterAntDistance[SENSORS_PER_ANT];
+	float sensorPositionAngle[SENSORS_PER_ANT];
+	int sensorPixelRadius[SENSORS_PER_ANT];
+}AntSpecies;
+
+// One ant unpacked from either storage. The tick loads it, works on this copy
+// and stores it back.
+typedef struct
+{
+	float posX;
+	float posY;
+	float theta;
+
+	uint8_t state;
+	int8_t pheromoneType;
+	uint8_t carryingFood;
+	int placePheromoneIntensity;
+	int lifeTime;
+}Ant;
+
+// Structure of arrays holding every ant of the environment. Ant i is the
+// i-th element of each array, so the tick and the render path walk
+// contiguous memory instead of chasing one heap object per ant. The id of an
+// ant is its index.
+//
+// FLOAT_ANTS stores 24 bytes per ant. COMPACT_ANTS quantizes positions to 16
+// bit fixed point, the heading to tenths of a degree and packs the state in
+// one byte, 11 bytes per ant, for swarms of tens of millions.
+class AntSwarm
+{
+	public:
+		AntStorage storage;
+		TrigMode trigMode;
+		// Key of every random draw of the ants, the seed of the experiment unless
+		// set before the first ant is added
+		uint32_t seed;
+
+		int numberOfAnts;
+		int capacity;
+		// The arrays live in a snapshot mapping, they are copied out before they
+		// grow and never freed
+		bool mappedArrays;
+
+		// Largest sensorPixelRadius of any ant, picks the sensing mode
+		int maxSensorPixelRadius;
+
+		// Index in allSpecies of every ant, at most 256 species
+		vector<AntSpecies> allSpecies;
+		uint8_t* species;
+
+		// FLOAT_ANTS state
+		float* posX;
+		float* posY;
+		float* theta;
+		uint8_t* state;
+		int8_t* pheromoneType;
+		uint8_t* carryingFood;
+		int* placePheromoneIntensity;
+		int* lifeTime;
+
+		// COMPACT_ANTS state
+		uint16_t* fixedX;
+		uint16_t* fixedY;
+		uint16_t* heading;
+		uint8_t* flags;
+		uint8_t* intensity;
+		uint16_t* age;
+
+	public:
+		AntSwarm();
+		~AntSwarm();
+
+		// Call while the swarm is empty
+		void setStorage(AntStorage newStorage);
+		size_t bytesPerAnt();
+
+		void reserve(int newCapacity);
+		void clear();
+		// Points the arrays at numberOfAnts ants of a snapshot mapping, arrays[k]
+		// holds the k-th array of forEachArray. allSpecies must already be set.
+		void adoptMappedArrays(uint8_t* const* arrays, int numberOfAnts);
+		int addAnt(float posX, float posY, AntParameters* antParameters);
+		// Reads the parameters of every species again, the ants keep their species
+		void updateSpecies();
+
+		// Calls visit on the pointer to every array of the storage in use, species
+		// first, in the same order for every swarm of that storage
+		template <class Visit>
+		void forEachArray(Visit visit)
+		{
+			visit(species);
+			if(storage == FLOAT_ANTS)
+			{
+				visit(posX);
+				visit(posY);
+				visit(theta);
+				visit(state);
+				visit(pheromoneType);
+				visit(carryingFood);
+				visit(placePheromoneIntensity);
+				visit(lifeTime);
+			}
+			else
+			{
+				visit(fixedX);
+				visit(fixedY);
+				visit(heading);
+				visit(flags);
+				visit(intensity);
+				visit(age);
+			}
+		}
+
+		inline AntSpecies& speciesOf(int i)
+		{
+			return allSpecies[species[i]];
+		}
+
+		inline uint8_t stateOf(int i)
+		{
+			return storage == FLOAT_ANTS ? state[i] : flags[i] & FLAGS_STATE_MASK;
+		}
+
+		inline Ant load(int i)
+		{
+			Ant ant;
+			if(storage == FLOAT_ANTS)
+			{
+				ant.posX = posX[i];
+				ant.posY = posY[i];
+				ant.theta = theta[i];
+				ant.state = state[i];
+				ant.pheromoneType = pheromoneType[i];
+				ant.carryingFood = carryingFood[i];
+				ant.placePheromoneIntensity = placePheromoneIntensity[i];
+				ant.lifeTime = lifeTime[i];
+			}
+			else
+			{
+				ant.posX = ((int)fixedX[i] - (int)FIXED_POSITION_ONE) / FIXED_POSITION_ONE;
+				ant.posY = ((int)fixedY[i] - (int)FIXED_POSITION_ONE) / FIXED_POSITION_ONE;
+				// The middle of the step, so the sin/cos index of the heading comes back exactly
+				ant.theta = (heading[i] + 0.5f) * (float)(2*M_PI / HEADING_STEPS);
+				ant.state = flags[i] & FLAGS_STATE_MASK;
+				ant.pheromoneType = ((flags[i] & FLAGS_PHEROMONE_MASK) >> FLAGS_PHEROMONE_SHIFT) - 1;
+				ant.carryingFood = (flags[i] & FLAGS_CARRYING_FOOD) != 0;
+				ant.placePheromoneIntensity = intensity[i];
+				ant.lifeTime = age[i];
+			}
+			return ant;
+		}
+
+		// Compact positions round up or down at random, in proportion to the
+		// remainder. Plain rounding turns the same way every tick and bends the
+		// paths towards the axes.
+		inline void store(int i, const Ant& ant, uint64_t tick)
+		{
+			if(storage == FLOAT_ANTS)
+			{
+				posX[i] = ant.posX;
+				posY[i] = ant.posY;
+				theta[i] = ant.theta;
+				state[i] = ant.state;
+				pheromoneType[i] = ant.pheromoneType;
+				carryingFood[i] = ant.carryingFood;
+				placePheromoneIntensity[i] = ant.placePheromoneIntensity;
+				lifeTime[i] = ant.lifeTime;
+			}
+			else
+			{
+				uint32_t dither = quantizationDither(i, tick);
+				fixedX[i] = quantizePosition(ant.posX, (dither & 0xFFFF) / 65536.0f);
+				fixedY[i] = quantizePosition(ant.posY, (dither >> 16) / 65536.0f);
+				int step = (int)floorf(ant.theta * (float)(HEADING_STEPS / (2*M_PI))) % HEADING_STEPS;
+				heading[i] = step < 0 ? step + HEADING_STEPS : step;
+				flags[i] = ant.state | ((ant.pheromoneType + 1) << FLAGS_PHEROMONE_SHIFT) | (ant.carryingFood ? FLAGS_CARRYING_FOOD : 0);
+				intensity[i] = min(max(ant.placePheromoneIntensity, 0), 255);
+				age[i] = min(ant.lifeTime, 65535);
+			}
+		}
+
+		// One tick of ant i: moves, senses and decides. Given the state the ant
+		// is in, the decision is picked at compile time instead of per ant.
+		template <int STATE = ANY_ANT_STATE>
+		void step(int i, int frameCounter, uint64_t tick, PheromoneMatrix* pheromoneMatrix, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex);
+
+		// One tick of the FLOAT_ANTS ants [begin, end), the same as step on each of
+		// them. Movement, sensor placement and, where the field allows it, the
+		// sensor boxes run as SIMD kernels over runs of ants of one species, then
+		// each ant decides.
+		void stepRange(int begin, int end, int frameCounter, uint64_t tick, PheromoneMatrix* pheromoneMatrix, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex, SimdLevel simdLevel);
+
+		AntSensor sensor(AntSpecies& antSpecies, AntSensorSide side);
+
+		template <int STATE>
+		void environmentAnalysis(int i, Ant& ant, AntSpecies& antSpecies, int frameCounter, uint64_t tick, PheromoneMatrix* pheromoneMatrix, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex);
+		bool nestColision(Ant& ant, LandmarkIndex<Anthill>* nestIndex);
+		bool foodColision(Ant& ant, LandmarkIndex<FoodSource>* foodIndex);
+		void changeState(Ant& ant, AntStates newState);
+		void makeDecision(int i, Ant& ant, uint64_t tick, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex, PheromoneReading left, PheromoneReading right);
+		template <AntStates STATE>
+		void decide(int i, Ant& ant, uint64_t tick, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex, PheromoneReading left, PheromoneReading right);
+		void move(Ant& ant, AntSpecies& antSpecies);
+
+	private:
+		void freeArrays();
+		void loadSpecies(AntSpecies& antSpecies, AntParameters* antParameters);
+		void senseBatch(int begin, int count, AntSpecies& antSpecies, PheromoneMatrix* pheromoneMatrix, PheromoneReading readings[SENSORS_PER_ANT][ANT_KERNEL_BATCH], SimdLevel simdLevel);
+
+		static inline void wrapTheta(Ant& ant)
+		{
+			if (ant.theta < 0) ant.theta += 2*M_PI;
+			if (ant.theta >= 2*M_PI) ant.theta -= 2*M_PI;
+		}
+
+		// Rounding only needs evenly spread bits, a full Philox block per ant
+		// and tick costs more than the rest of the store. Murmur3 finalizer.
+		inline uint32_t quantizationDither(int i, uint64_t tick)
+		{
+			uint32_t h = seed ^ ((uint32_t)i * 0x9E3779B1u) ^ ((uint32_t)tick * 0x85EBCA77u);
+			h ^= h >> 16;
+			h *= 0x85EBCA6Bu;
+			h ^= h >> 13;
+			h *= 0xC2B2AE35u;
+			h ^= h >> 16;
+			return h;
+		}
+
+		static inline uint16_t quantizePosition(float position, float dither)
+		{
+			int fixed = (int)floorf(position * FIXED_POSITION_ONE + FIXED_POSITION_ONE + dither);
+			return min(max(fixed, 0), 65535);
+		}
+};
+#endif
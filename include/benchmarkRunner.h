@@ -0,0 +1,57 @@
+#ifndef BENCHMARKRUNNER_H
+#define BENCHMARKRUNNER_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+typedef struct
+{
+	string name;
+	int ants;
+	int gridSize;
+	int repetitions;
+
+	// Work done by one call: ants, cells or sensor reads, and bytes read plus
+	// written (0 when a bandwidth figure would not mean anything)
+	double items;
+	double bytes;
+
+	double meanSeconds;
+	double stddevSeconds;
+	double minSeconds;
+	double maxSeconds;
+}BenchmarkResult;
+
+// A figure that is not a timing, like the error of an approximation
+typedef struct
+{
+	string name;
+	double value;
+}BenchmarkMetric;
+
+// Times benchmark bodies and keeps their statistics. One warm up call is
+// discarded, then the body is timed repetitions times. The optional setup
+// runs before every call and is not timed.
+class BenchmarkRunner
+{
+	public:
+		int repetitions;
+		string filter;
+		vector<BenchmarkResult> results;
+		vector<BenchmarkMetric> metrics;
+
+	public:
+		BenchmarkRunner(int repetitions, string filter);
+
+		bool selected(string name);
+		void run(string name, int ants, int gridSize, double items, double bytes, function<void()> body, function<void()> setup = nullptr);
+		void record(string name, double value);
+
+		// Machine readable report, one object per benchmark
+		void writeJSON(const char* path, int numberOfThreads, const char* simdLevel);
+};
+
+#endif
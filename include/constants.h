@@ -6,6 +6,13 @@ extern unsigned int PIXEL_WIDTH;
 extern unsigned int PIXEL_HEIGHT;
 extern unsigned int GLOBAL_SEED;
 
+// Bounds of the world resolution read from the experiment, in cells per side.
+// Sensors are clamped into the grid, which holds while the side fits the box
+// of a sensor, 2 * radius + 1 cells (the evolution goes up to radius 8). Above
+// the maximum float positions no longer tell every cell apart.
+#define MIN_WORLD_SIDE 64
+#define MAX_WORLD_SIDE (1 << 24)
+
 void setGlobalSeed(unsigned int globalSeed);
 void setScrHeight(unsigned int scrHeight);
 void setScrWidth(unsigned int scrWidth);
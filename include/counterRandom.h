@@ -0,0 +1,90 @@
+#ifndef COUNTERRANDOM_H
+#define COUNTERRANDOM_H
+
+#include <cstdint>
+
+// Independent random streams drawn by every ant, and by the evolutionary
+// algorithm with the individual in place of the ant and the generation in
+// place of the tick
+enum RandomStream
+{
+	SPAWN_STREAM,
+	DECISION_STREAM,
+	EVOLUTION_STREAM
+};
+
+// Philox4x32-10 counter based generator (Salmon et al., "Parallel random
+// numbers: as easy as 1, 2, 3"). The output is a pure function of the key
+// (seed) and of the counter (ant, tick, stream), so any ant's draws can be
+// computed in any order, on any thread, and are the same on every run with
+// the same seed.
+class CounterRandom
+{
+	public:
+		uint32_t key[2];
+		uint32_t counter[4];
+		uint32_t words[4];
+		int used;
+
+		CounterRandom(uint32_t seed, uint32_t antId, uint64_t tick, RandomStream stream)
+		{
+			key[0] = seed;
+			key[1] = 0x5eed5eedu;
+
+			counter[0] = (uint32_t)tick;
+			counter[1] = (uint32_t)(tick >> 32);
+			counter[2] = antId;
+			counter[3] = (uint32_t)stream;
+
+			// Words are only generated on the first draw
+			used = 4;
+		}
+
+		uint32_t next()
+		{
+			if(used == 4)
+			{
+				philox();
+				// Further blocks of the same (ant, tick, stream) use the high half of the stream word
+				counter[3] += 0x10000u;
+				used = 0;
+			}
+			return words[used++];
+		}
+
+	private:
+		static inline void multiplyHighLow(uint32_t a, uint32_t b, uint32_t* high, uint32_t* low)
+		{
+			uint64_t product = (uint64_t)a * b;
+			*high = (uint32_t)(product >> 32);
+			*low = (uint32_t)product;
+		}
+
+		void philox()
+		{
+			uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+			uint32_t k0 = key[0], k1 = key[1];
+
+			for(int round = 0; round < 10; round++)
+			{
+				uint32_t high0, low0, high1, low1;
+				multiplyHighLow(0xD2511F53u, c0, &high0, &low0);
+				multiplyHighLow(0xCD9E8D57u, c2, &high1, &low1);
+
+				c0 = high1 ^ c1 ^ k0;
+				c1 = low1;
+				c2 = high0 ^ c3 ^ k1;
+				c3 = low0;
+
+				k0 += 0x9E3779B9u;
+				k1 += 0xBB67AE85u;
+			}
+
+			words[0] = c0;
+			words[1] = c1;
+			words[2] = c2;
+			words[3] = c3;
+		}
+};
+
+#endif
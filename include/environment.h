@@ -1,17 +1,38 @@
 #ifndef ENVIRONMENT_H
 #define ENVIRONMENT_H
 
-#include <openglBuffersManager.h>
+#include <antSwarm.h>
+#include <threadPool.h>
+#include <pheromoneMatrix.h>
+#include <snapshot.h>
+#include <trajectoryRecorder.h>
+#include <pheromoneRecorder.h>
+#include <trace.h>
 
+// Number of ants handed to a thread at a time by the parallel tick
+#define ANT_CHUNK_SIZE 2048
+
+// Simulation state and tick, free of any OpenGL dependency so it also runs
+// headless. OpenglBuffersManager mirrors it into the GPU buffers.
 class Environment
 {
 	public:
-		uint8_t* pheromoneMatrix;
+		PheromoneMatrix* pheromoneMatrix;
 		
 		ParameterAssigner* parameterAssigner;
+		ThreadPool* threadPool;
+
+		// Ticks simulated since the environment was initialized, never wraps
+		uint64_t tick;
 
 		int placePheromoneRate;
 		int pheromoneEvaporationRate;
+		SensingMode sensingMode;
+		EvaporationMode evaporationMode;
+		CollisionMode collisionMode;
+		UpdateMode updateMode;
+		// Instruction set of the ant kernels, the widest the CPU has
+		SimdLevel simdLevel;
 
 		int numberOfNests;
 		int numberOfFoods;
@@ -19,27 +40,64 @@ class Environment
 
 		vector<Anthill*> nests;
 		vector<FoodSource*> foods;
-		vector<Ant*> ants;
+		AntSwarm ants;
+
+		// What the ants collide with, kept in step with nests and foods
+		LandmarkIndex<Anthill> nestIndex;
+		LandmarkIndex<FoodSource> foodIndex;
+
+		// PARTITIONED_UPDATE: ant indices grouped by state at the start of the
+		// tick, in ant order within a state. The ants of state s are
+		// antsByState[stateBegin[s], stateBegin[s + 1]).
+		vector<int> antsByState;
+		int stateBegin[NUMBER_OF_ANT_STATES + 1];
+		vector<int> chunkStateOffsets;
+
+		// File mapping of the last restored snapshot, the ant arrays and the
+		// pheromone field may still point into it
+		void* snapshotMapping;
+		size_t snapshotMappingBytes;
+
+		// Writes the ants to EnvironmentParameters::trajectoryPath, NULL when no
+		// path is set
+		TrajectoryRecorder* trajectoryRecorder;
+		// Dumps the field to EnvironmentParameters::pheromonePath, NULL when no
+		// path is set
+		PheromoneRecorder* pheromoneRecorder;
 
 	public:
 
 		Environment(ParameterAssigner* parametersAssigner);
+		~Environment();
 
-		void initializeEnvironment(OpenglBuffersManager* openglBuffersManager);
+		void initializeEnvironment();
 		void resetEnvironment();
 
-		void createNest(int idNest, OpenglBuffersManager* openglBuffersManager);
-		void createFoodSource(int idFood, OpenglBuffersManager* openglBuffersManager);
-		void createAnt(int idNest, OpenglBuffersManager* openglBuffersManager);
+		void createNest(int idNest);
+		void createFoodSource(int idFood);
+		void createAnt(int idNest);
 
 		void run(int frameCounter);
-		void draw(OpenglBuffersManager* openglBuffersManager, Camera* camera);
 
 		void moveAnts(int frameCounter);
+		void partitionAntsByState();
+		template <AntStates STATE>
+		void moveAntsInState(int frameCounter);
+		bool useSummedAreaSensing();
+		void removeEmptyFoodSources();
 
 		void placePheromone(int frameCounter);
 
 		void pheromoneEvaporation(int frameCounter);
+
+		// Writes the whole state to path, through a temporary file so a crash
+		// never leaves a half written snapshot behind
+		bool saveSnapshot(const char* path);
+		// Maps a snapshot of an environment built from the same experiment and
+		// continues from it, false when the file does not fit this environment
+		bool loadSnapshot(const char* path);
+		// Unmaps the last restored snapshot, once nothing points into it
+		void releaseSnapshot();
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,124 @@
+#ifndef EVOLUTIONARYALGORITHM_H
+#define EVOLUTIONARYALGORITHM_H
+
+#include <environment.h>
+#include <counterRandom.h>
+
+#include <string>
+
+// Fields of AntParameters and of its two sensors an individual carries. The
+// rest of the species is taken from the experiment unchanged.
+enum Gene
+{
+	GENE_VELOCITY,
+	GENE_PLACE_PHEROMONE_INTENSITY,
+	GENE_RIGHT_X_DISTANCE,
+	GENE_RIGHT_Y_DISTANCE,
+	GENE_RIGHT_ANGLE,
+	GENE_RIGHT_RADIUS,
+	GENE_LEFT_X_DISTANCE,
+	GENE_LEFT_Y_DISTANCE,
+	GENE_LEFT_ANGLE,
+	GENE_LEFT_RADIUS,
+	NUMBER_OF_GENES
+};
+
+typedef struct
+{
+	const char* name;
+	float minimum;
+	float maximum;
+	// Rounded after crossover and mutation
+	bool integer;
+}GeneRange;
+
+extern const GeneRange GENE_RANGES[NUMBER_OF_GENES];
+
+typedef struct
+{
+	float genes[NUMBER_OF_GENES];
+	// Food taken from the sources during the evaluation, -1 until evaluated
+	double fitness;
+}Individual;
+
+typedef struct
+{
+	int generation;
+	// Seed of the ants of every evaluation of the generation
+	uint32_t seed;
+	double bestFitness;
+	double meanFitness;
+	double seconds;
+	Individual best;
+}GenerationResult;
+
+// Evolves one ant species of an experiment. Every individual is simulated in
+// an Environment of its own with one thread, and the individuals of a
+// generation are handed to the threads of a pool one at a time, so a
+// generation keeps every core busy however long each evaluation takes.
+//
+// A generation is a pure function of the seed and of its population: the ants
+// of every evaluation draw from a seed of the generation, and the choices that
+// breed child c of generation g come from the stream (seed, c, g). The same
+// parameters give the same individuals for any number of threads.
+class EvolutionaryAlgorithm
+{
+	public:
+		EvolutionParameters parameters;
+		// Generation evaluated by the next call to runGeneration
+		int generation;
+		vector<Individual> population;
+
+	private:
+		// Copy of the experiment, nests and food sources still point into the
+		// original one, which must outlive the algorithm
+		ParameterAssigner experiment;
+		// Species being evolved, copied so that changing the experiment while
+		// evolving does not race with the evaluations
+		AntParameters species;
+		AntSensorParameters sensors[SENSORS_PER_ANT];
+
+		ThreadPool* threadPool;
+
+		// Written by runGeneration, read by any thread through results
+		mutex resultsMutex;
+		vector<GenerationResult> history;
+
+		thread worker;
+		atomic<bool> running;
+		atomic<bool> stopping;
+
+	public:
+		EvolutionaryAlgorithm(ParameterAssigner* parameterAssigner, EvolutionParameters parameters);
+		~EvolutionaryAlgorithm();
+
+		// Evaluates the population and breeds the next one, false when stopped
+		// before every individual was evaluated
+		bool runGeneration();
+
+		// Runs the remaining generations on a thread of its own
+		void start();
+		// Abandons the generation being evaluated and waits for the thread
+		void stop();
+		bool isRunning();
+
+		vector<GenerationResult> results();
+
+		// Seed of the ants of every evaluation of a generation
+		uint32_t evaluationSeed(int generation);
+
+		void encode(AntParameters* antParameters, Individual* individual);
+		// Writes the genes into antParameters and its sensors
+		void decode(const Individual& individual, AntParameters* antParameters);
+		static string describe(const Individual& individual);
+
+	private:
+		double evaluate(const Individual& individual, uint32_t seed);
+		void breed();
+		int select(CounterRandom& random, double totalFitness);
+		void crossover(const Individual& first, const Individual& second, CounterRandom& random, Individual* child);
+		void mutate(CounterRandom& random, Individual* child);
+		void workerLoop();
+};
+
+#endif
@@ -13,9 +13,23 @@ class FoodSource
 		int foodAmount;
 		float posX, posY;
 		float size;
+		// Amount the source was created with, the drawn size follows the rest
+		int initialAmount;
+		// Set by the take that retires the source
+		bool retired;
+		// Set by every take that removes food, cleared once the GUI redraws it
+		bool changed;
 
 		FoodSource(FoodSourceParameters* foodParameters);
 
 		bool antColision(float antPosx, float antPosY);
+
+		// Takes one unit of food, safe from any thread, the amount never goes
+		// below zero. True once, for the take that empties the source or the
+		// first take of a source that starts empty.
+		bool take();
+
+		// Side of the drawn square, its area shrinks with the food left
+		float drawnSize();
 };
 #endif
\ No newline at end of file
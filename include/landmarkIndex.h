@@ -0,0 +1,221 @@
+#ifndef LANDMARKINDEX_H
+#define LANDMARKINDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+// Cells per side of the index grid over the world square [-1, 1]
+#define LANDMARK_INDEX_CELLS 256
+
+// Raster ids are 16 bits, 0 marks a pixel without landmark
+#define LANDMARK_RASTER_MAX_ID UINT16_MAX
+
+// Uniform grid of the nests or food sources of the environment. A landmark is
+// listed in every cell its square overlaps, so finding the landmark under an
+// ant tests the few landmarks of one cell instead of all of them.
+//
+// Each cell keeps its landmarks in insertion order, find returns the first one
+// that holds the point, the same landmark a linear scan of the insertion order
+// returns. Landmark is any type with posX, posY, size and antColision.
+//
+// With useRaster find becomes a single load instead: every pixel of a raster
+// as large as the pheromone grid holds the id of the first landmark whose
+// square touches it. Squares are covered to whole pixels, so an ant on a
+// border pixel collides a little outside the square.
+template <class Landmark>
+class LandmarkIndex
+{
+	public:
+		int cellsPerSide;
+		float cellSize;
+		vector<vector<Landmark*>> cells;
+		int numberOfLandmarks;
+
+		// Landmarks retired during a parallel tick, removed by removeRetired
+		vector<Landmark*> retired;
+		mutex retiredMutex;
+
+		// Raster mode, raster is empty otherwise. Ids grow with insertion order,
+		// so the smaller id wins where squares overlap.
+		int rasterWidth, rasterHeight;
+		vector<uint16_t> raster;
+		vector<Landmark*> rasterLandmarks;
+		unordered_map<Landmark*, uint16_t> rasterIds;
+
+	public:
+		LandmarkIndex(int cellsPerSide = LANDMARK_INDEX_CELLS)
+		{
+			this->cellsPerSide = cellsPerSide;
+			cellSize = 2.0f / cellsPerSide;
+			cells.resize((size_t)cellsPerSide * cellsPerSide);
+			numberOfLandmarks = 0;
+			rasterWidth = rasterHeight = 0;
+		}
+
+		// Call while the index is empty
+		void useRaster(int width, int height)
+		{
+			rasterWidth = width;
+			rasterHeight = height;
+			raster.assign((size_t)width * height, 0);
+		}
+
+		void clear()
+		{
+			for(vector<Landmark*>& cell : cells) cell.clear();
+			retired.clear();
+			numberOfLandmarks = 0;
+
+			fill(raster.begin(), raster.end(), 0);
+			rasterLandmarks.clear();
+			rasterIds.clear();
+		}
+
+		void insert(Landmark* landmark)
+		{
+			forEachCell(landmark, [&](vector<Landmark*>& cell) { cell.push_back(landmark); });
+			numberOfLandmarks++;
+
+			if(raster.empty()) return;
+			if(rasterLandmarks.size() == LANDMARK_RASTER_MAX_ID) renumberRaster();
+			if(rasterLandmarks.size() == LANDMARK_RASTER_MAX_ID)
+			{
+				// More live landmarks than ids, the grid answers from now on
+				fprintf(stderr, "more than %d landmarks, collisions fall back to the index grid\n", LANDMARK_RASTER_MAX_ID);
+				dropRaster();
+				return;
+			}
+			rasterLandmarks.push_back(landmark);
+			rasterIds[landmark] = rasterLandmarks.size();
+			stamp(landmark);
+		}
+
+		void remove(Landmark* landmark)
+		{
+			forEachCell(landmark, [&](vector<Landmark*>& cell) { cell.erase(std::remove(cell.begin(), cell.end(), landmark), cell.end()); });
+			numberOfLandmarks--;
+
+			if(raster.empty()) return;
+			uint16_t id = rasterIds[landmark];
+			rasterIds.erase(landmark);
+			rasterLandmarks[id - 1] = NULL;
+
+			// Pixels the landmark held go back to the next landmark under them. A
+			// landmark sharing one of those pixels is at most a pixel away.
+			forEachPixel(landmark, [&](uint16_t& pixel) { if(pixel == id) pixel = 0; });
+			float pixelSize = 2.0f / min(rasterWidth, rasterHeight);
+			forEachCell(landmark, [&](vector<Landmark*>& cell) { for(Landmark* neighbour : cell) stamp(neighbour); }, pixelSize);
+		}
+
+		// Landmark whose square holds the point, NULL if there is none
+		inline Landmark* find(float x, float y)
+		{
+			if(!raster.empty())
+			{
+				uint16_t id = raster[(size_t)rasterRow(y) * rasterWidth + rasterColumn(x)];
+				return id == 0 ? NULL : rasterLandmarks[id - 1];
+			}
+
+			for(Landmark* landmark : cells[(size_t)cellCoordinate(y) * cellsPerSide + cellCoordinate(x)])
+				if(landmark->antColision(x, y)) return landmark;
+			return NULL;
+		}
+
+		// Safe from any thread. The landmark stays findable until removeRetired
+		// runs, so every ant of a tick sees the same landmarks whatever the split.
+		void retire(Landmark* landmark)
+		{
+			lock_guard<mutex> lock(retiredMutex);
+			retired.push_back(landmark);
+		}
+
+		// Removes the retired landmarks and returns them, the caller owns them again
+		vector<Landmark*> removeRetired()
+		{
+			vector<Landmark*> removed;
+			removed.swap(retired);
+			for(Landmark* landmark : removed) remove(landmark);
+			return removed;
+		}
+
+	private:
+		// Monotonic in v, so a point inside a square falls in one of the cells
+		// the square was listed in
+		inline int cellCoordinate(float v)
+		{
+			int c = (int)((v + 1.0f) / cellSize);
+			return min(max(c, 0), cellsPerSide - 1);
+		}
+
+		// Same pixel as the pheromone an ant places, and monotonic like cellCoordinate
+		inline int rasterColumn(float x)
+		{
+			int c = (int)((rasterWidth/2) + x * (rasterWidth/2));
+			return min(max(c, 0), rasterWidth - 1);
+		}
+
+		inline int rasterRow(float y)
+		{
+			int r = (int)((rasterHeight/2) + y * (rasterHeight/2));
+			return min(max(r, 0), rasterHeight - 1);
+		}
+
+		template <class Visit>
+		void forEachCell(Landmark* landmark, Visit visit, float margin = 0.0f)
+		{
+			float half = landmark->size + margin;
+			int x0 = cellCoordinate(landmark->posX - half), x1 = cellCoordinate(landmark->posX + half);
+			int y0 = cellCoordinate(landmark->posY - half), y1 = cellCoordinate(landmark->posY + half);
+			for(int y = y0; y <= y1; y++)
+				for(int x = x0; x <= x1; x++) visit(cells[(size_t)y * cellsPerSide + x]);
+		}
+
+		template <class Visit>
+		void forEachPixel(Landmark* landmark, Visit visit)
+		{
+			int x0 = rasterColumn(landmark->posX - landmark->size), x1 = rasterColumn(landmark->posX + landmark->size);
+			int y0 = rasterRow(landmark->posY - landmark->size), y1 = rasterRow(landmark->posY + landmark->size);
+			for(int y = y0; y <= y1; y++)
+				for(int x = x0; x <= x1; x++) visit(raster[(size_t)y * rasterWidth + x]);
+		}
+
+		// The smaller id wins, so stamping in any order gives the same raster
+		void stamp(Landmark* landmark)
+		{
+			uint16_t id = rasterIds[landmark];
+			forEachPixel(landmark, [&](uint16_t& pixel) { if(pixel == 0 || id < pixel) pixel = id; });
+		}
+
+		void dropRaster()
+		{
+			vector<uint16_t>().swap(raster);
+			vector<Landmark*>().swap(rasterLandmarks);
+			rasterIds.clear();
+		}
+
+		// Ids of removed landmarks are never reused, once they run out the live
+		// landmarks get consecutive ids again in the same order
+		void renumberRaster()
+		{
+			vector<Landmark*> live;
+			for(Landmark* landmark : rasterLandmarks)
+				if(landmark != NULL) live.push_back(landmark);
+
+			rasterLandmarks.swap(live);
+			rasterIds.clear();
+			fill(raster.begin(), raster.end(), 0);
+			for(size_t i = 0; i < rasterLandmarks.size(); i++)
+			{
+				rasterIds[rasterLandmarks[i]] = i + 1;
+				stamp(rasterLandmarks[i]);
+			}
+		}
+};
+
+#endif
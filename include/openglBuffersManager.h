@@ -7,12 +7,12 @@
 #include <UI.h>
 #include <camera.h>
 
-#include <ant.h>
+#include <environment.h>
 
 // Pixel mapping (for pheromone)
 extern int    CHANNEL_COUNT;
 extern GLenum PIXEL_FORMAT;
-extern int    DATA_SIZE; // Size of the pixel data content
+extern size_t DATA_SIZE; // Size of the pixel data content
 extern GLuint pboIds[2]; // IDs of PBO
 extern GLuint textureId; // ID of texture
 extern int indexPBO;
@@ -53,6 +53,12 @@ class OpenglBuffersManager
 
 	    VAO* pheromoneVAO;    
 	    GLbitfield* pixelMap;  
+	    // Size in cells of the pheromone texture, follows the world of the environment
+	    int textureWidth;
+	    int textureHeight;
+	    // The texture is streamed through the two pixel buffers, false for the
+	    // tiled layout that uploads its tiles directly
+	    bool texturePixelBuffers;
 
 		OpenglBuffersManager();
 		void resetBufferManager();
@@ -62,23 +68,32 @@ class OpenglBuffersManager
 		void updateBufferData(VBO* vertexBufferObject, int numberOfElements, vector <glm::mat4> transformationMatrices);
 
 		void createFoodComponents();
+		void addFoodSource(FoodSource* food, int numberOfFoods);
+		void updateFoodSources(vector<FoodSource*>& foods);
 		void drawFoods(int numberOfFoods, Camera* camera);
 	
 		void createAnthillComponents();
+		void addAnthill(Anthill* anthill, int numberOfAnthills);
 		void drawAnthills(int numberOfAnthills, Camera* camera);
 
 		void createAntComponents();
+		void addAnts(AntSwarm* ants, int firstAnt);
 		void drawAnts(int numberOfAnts, Camera* camera);
 		
 
 
-		void updateModelAnts(int numberOfAnts, vector<Ant*> ants);
+		void updateModelAnts(AntSwarm* ants);
 
 		void createPheromoneComponents();
+		void resizePheromoneBuffers(int width, int height, bool pixelBuffers);
 		void createTextureBuffer();
+		void clearTextureBuffer();
 		void createPixelBuffers();
-		void swapPixelBuffers(uint8_t* pheromoneMatrix);
-		void drawPheromone(uint8_t* pheromoneMatrix, Camera* camera);
+		void swapPixelBuffers(PheromoneMatrix* pheromoneMatrix);
+		void uploadPheromoneTiles(PheromoneMatrix* pheromoneMatrix);
+		void drawPheromone(PheromoneMatrix* pheromoneMatrix, Camera* camera);
+
+		void drawEnvironment(Environment* environment, Camera* camera);
 
 };
 
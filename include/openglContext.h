@@ -7,7 +7,9 @@
 #pragma once
 
 #include <environment.h>
+#include <evolutionaryAlgorithm.h>
 #include <openglBuffersManager.h>
+#include <trajectoryPlayer.h>
 
 /**
  * @struct AdditionalCallbackParameters
@@ -33,6 +35,8 @@ class OpenglContext {
   UI* userInterface;                 ///< User interface object.
   Environment* environment;          ///< Environment object.
   ParameterAssigner* parameterAssigner;  ///< Parameter assigner object.
+  EvolutionaryAlgorithm* evolution;  ///< Last evolution started from the UI,
+                                     ///< NULL before the first one.
 
   unsigned int frameCounter;        ///< Frame counter.
   int openGlRenderUpdateFrameRate;  ///< Frame rate for OpenGL rendering
@@ -47,5 +51,14 @@ class OpenglContext {
       OpenglBuffersManager* openglBuffersManager);  ///< Run the rendering loop.
   void pre_render();   ///< Perform pre-render setup.
   void post_render();  ///< Perform post-render tasks.
+  void snapshotActions(
+      OpenglBuffersManager* openglBuffersManager);  ///< Save or load a
+                                                    ///< snapshot on request.
+  void mirrorEnvironment(OpenglBuffersManager* openglBuffersManager,
+                         Environment* mirrored);  ///< Rebuild the buffers
+                                                  ///< from an environment.
+  void replay(OpenglBuffersManager* openglBuffersManager);  ///< Play a
+                                                            ///< trajectory.
+  void evolutionActions();  ///< Start, stop or apply an evolution on request.
 };
 
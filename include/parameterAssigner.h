@@ -24,13 +24,83 @@ enum PheromoneType
 	BLUE
 };
 
+enum PheromoneLayout
+{
+	INTERLEAVED_RGBA,
+	PLANAR,
+	TILED
+};
+
+enum EvaporationMode
+{
+	EAGER_EVAPORATION,
+	LAZY_EVAPORATION
+};
+
+enum SensingMode
+{
+	DIRECT_SENSING,
+	SUMMED_AREA_SENSING,
+	AUTO_SENSING
+};
+
+enum CollisionMode
+{
+	INDEX_COLLISION,
+	RASTER_COLLISION
+};
+
+enum AntStorage
+{
+	FLOAT_ANTS,
+	COMPACT_ANTS
+};
+
+enum UpdateMode
+{
+	MIXED_UPDATE,
+	PARTITIONED_UPDATE
+};
+
+enum TrigMode
+{
+	TABLE_TRIG,
+	POLYNOMIAL_TRIG
+};
+
+enum TrajectoryPolicy
+{
+	DROP_FRAMES,
+	THROTTLE_FRAMES
+};
+
+enum SelectionMode
+{
+	TOURNAMENT_SELECTION,
+	ROULETTE_SELECTION
+};
+
+enum CrossoverMode
+{
+	UNIFORM_CROSSOVER,
+	ONE_POINT_CROSSOVER,
+	BLEND_CROSSOVER
+};
+
+enum MutationMode
+{
+	GAUSSIAN_MUTATION,
+	UNIFORM_MUTATION
+};
+
 enum AntStates
 {
 	EXPLORER,
 	BACKHOME,
 	CARRIER,
 	NESTCARRIER,
-	FOLLOWGREEN
+	FOLLOWGREEN,
+	NUMBER_OF_ANT_STATES
 };
 
 enum SensorType
@@ -46,8 +116,51 @@ typedef struct
 {
 	int placePheromoneRate;
    	int pheromoneEvaporationRate;
+   	int numberOfThreads;
+   	PheromoneLayout pheromoneLayout;
+   	SensingMode sensingMode;
+   	EvaporationMode evaporationMode;
+   	CollisionMode collisionMode;
+   	AntStorage antStorage;
+   	UpdateMode updateMode;
+   	TrigMode trigMode;
+
+   	// Trajectory recording, off while trajectoryPath is empty
+   	string trajectoryPath;
+   	int trajectoryInterval;
+   	TrajectoryPolicy trajectoryPolicy;
+
+   	// Pheromone time series, off while pheromonePath is empty. A keyframe every
+   	// pheromoneKeyframeInterval dumped frames.
+   	string pheromonePath;
+   	int pheromoneInterval;
+   	int pheromoneKeyframeInterval;
 }EnvironmentParameters;
 
+typedef struct
+{
+	// Ant species of the experiment being evolved
+	int antEspecification;
+	int populationSize;
+	int generations;
+	// Ticks every individual is simulated for
+	int evaluationTicks;
+	// Best individuals copied unchanged into the next generation
+	int elitism;
+	SelectionMode selection;
+	int tournamentSize;
+	CrossoverMode crossover;
+	float crossoverRate;
+	MutationMode mutation;
+	// Chance of each gene to mutate, and the spread of a gaussian mutation as
+	// a fraction of the range of the gene
+	float mutationRate;
+	float mutationScale;
+	// Individuals evaluated at once, 0 means one per hardware thread
+	int numberOfThreads;
+	unsigned int seed;
+}EvolutionParameters;
+
 typedef struct 
 {
 	int id;
@@ -101,6 +214,7 @@ class ParameterAssigner
 {
 	public:
 		EnvironmentParameters environmentParameters;
+		EvolutionParameters evolutionParameters;
 		vector <AnthillParameters *> anthillParameters;
 		vector <FoodSourceParameters *> foodParameters;
 		vector <AntParameters *> antParameters;
@@ -0,0 +1,32 @@
+#ifndef PHEROMONEKERNELS_H
+#define PHEROMONEKERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// Byte pattern subtracted from every 32 bits of the pheromone buffer by one
+// evaporation step, RGBA leaves the alpha byte alone
+#define EVAPORATION_PATTERN_RGBA 0x00010101u
+#define EVAPORATION_PATTERN_PLANAR 0x01010101u
+
+enum SimdLevel
+{
+	SIMD_SCALAR,
+	SIMD_SSE2,
+	SIMD_AVX2,
+	SIMD_AVX512
+};
+
+// Widest instruction set supported by the running CPU, detected once
+SimdLevel detectSimdLevel();
+const char* simdLevelName(SimdLevel simdLevel);
+
+// Saturating subtract of the 32 bit pattern over data[0, bytes), in a single
+// pass. data must start on a 4 byte boundary of the pattern.
+void evaporatePheromone(uint8_t* data, size_t bytes, uint32_t pattern);
+void evaporatePheromone(uint8_t* data, size_t bytes, uint32_t pattern, SimdLevel simdLevel);
+
+// Builds numberOfCells RGBA pixels (alpha 255) out of three channel planes
+void interleavePheromonePlanes(const uint8_t* red, const uint8_t* green, const uint8_t* blue, uint8_t* rgba, size_t numberOfCells);
+
+#endif
@@ -0,0 +1,378 @@
+#ifndef PHEROMONEMATRIX_H
+#define PHEROMONEMATRIX_H
+
+#include <parameterAssigner.h>
+#include <pheromoneKernels.h>
+#include <threadPool.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#define PHEROMONE_CHANNELS 3
+
+// Number of rows handed to a thread at a time by the full grid sweeps
+#define PHEROMONE_ROW_CHUNK 32
+// Number of columns handed to a thread at a time by the summed area column pass
+#define SUMMED_AREA_COLUMN_CHUNK 512
+// Lazy evaporation keeps one time stamp per square block of 2^LAZY_BLOCK_SHIFT cells
+#define LAZY_BLOCK_SHIFT 4
+#define LAZY_BLOCK_SIZE (1 << LAZY_BLOCK_SHIFT)
+// The tiled layout allocates square RGBA tiles of 2^PHEROMONE_TILE_SHIFT cells
+#define PHEROMONE_TILE_SHIFT 6
+#define PHEROMONE_TILE_SIZE (1 << PHEROMONE_TILE_SHIFT)
+#define PHEROMONE_TILE_BYTES (PHEROMONE_TILE_SIZE * PHEROMONE_TILE_SIZE * 4)
+// Number of active tiles handed to a thread at a time
+#define PHEROMONE_TILE_CHUNK 16
+
+// Sums of the three channels over one sensor box
+typedef struct
+{
+	int red;
+	int green;
+	int blue;
+}PheromoneReading;
+
+// Pheromone field of the environment, one byte per channel and cell.
+// INTERLEAVED_RGBA keeps the texture layout (R, G, B and a constant alpha per
+// cell) so it can be uploaded as is. PLANAR keeps three dense planes and only
+// interleaves when the texture is filled. TILED only allocates the RGBA tiles
+// that hold pheromone, so memory and the per step work follow the trail area
+// instead of the world area.
+//
+// With LAZY_EVAPORATION an evaporation step only counts the step. Each block
+// remembers the step it was last brought up to date at, readers subtract the
+// missing steps on the fly and deposits settle the block first, which gives
+// exactly the values of the eager sweep. settle brings every block up to date
+// before the field is uploaded or read as a whole. The tiled layout always
+// evaporates eagerly, it only sweeps the active tiles anyway.
+class PheromoneMatrix
+{
+	public:
+		PheromoneLayout layout;
+		int width;
+		int height;
+		size_t numberOfCells;
+
+		uint8_t* data;
+		size_t dataSize;
+		// data lives in a snapshot mapping and is never freed
+		bool mappedData;
+
+		// First byte of each channel and distance in bytes between two cells
+		uint8_t* channels[PHEROMONE_CHANNELS];
+		int pixelStride;
+
+		// Optional summed area table of each channel, (width+1) x (height+1) with a
+		// zero first row and column. Sums wrap modulo 2^32 but a box sum always
+		// fits, so the differences stay exact on any grid size.
+		uint32_t* summedArea[PHEROMONE_CHANNELS];
+		bool summedAreaReady;
+
+		EvaporationMode evaporationMode;
+		uint32_t evaporationSteps;
+
+		// Lazy evaporation blocks, last step applied and whether any value may be non zero
+		int blocksX;
+		int blocksY;
+		uint32_t* blockStep;
+		uint8_t* blockActive;
+
+		// Tiled layout: one pointer per tile, NULL while the tile holds no pheromone,
+		// and the highest value of each tile so fully evaporated tiles are found
+		// without scanning them
+		int tilesX;
+		int tilesY;
+		uint8_t** tiles;
+		uint8_t* tilePeak;
+		std::vector<int> activeTiles;
+		// Tiles freed since the last upload, the texture still shows them
+		std::vector<int> releasedTiles;
+
+	public:
+		PheromoneMatrix(int width, int height, PheromoneLayout layout, EvaporationMode evaporationMode);
+		~PheromoneMatrix();
+
+		void clear();
+
+		// Takes dataSize bytes of a snapshot mapping, 64 byte aligned, as the field.
+		// The caller keeps the mapping alive as long as the matrix.
+		void adoptMappedData(uint8_t* mapped);
+		// Allocates a tile full of zeros, call while the tile is NULL
+		void allocateTile(int tile);
+
+		inline uint8_t* cell(int channel, size_t index)
+		{
+			return channels[channel] + index * pixelStride;
+		}
+
+		inline size_t blockIndex(int x, int y)
+		{
+			return (size_t)(y >> LAZY_BLOCK_SHIFT) * blocksX + (x >> LAZY_BLOCK_SHIFT);
+		}
+
+		inline int tileIndex(int x, int y)
+		{
+			return (y >> PHEROMONE_TILE_SHIFT) * tilesX + (x >> PHEROMONE_TILE_SHIFT);
+		}
+
+		inline size_t tileOffset(int x, int y)
+		{
+			return ((size_t)(y & (PHEROMONE_TILE_SIZE - 1)) * PHEROMONE_TILE_SIZE + (x & (PHEROMONE_TILE_SIZE - 1))) * 4;
+		}
+
+		// Makes a cell ready to take deposits: allocates its tile or brings its lazy
+		// block up to date. Changes the shape of the store, so never concurrent.
+		inline void prepareDeposit(int x, int y)
+		{
+			if(layout == TILED)
+			{
+				int tile = tileIndex(x, y);
+				if(tiles[tile] == NULL) allocateTile(tile);
+			}
+			else if(evaporationMode == LAZY_EVAPORATION)
+			{
+				size_t block = blockIndex(x, y);
+				if(blockStep[block] != evaporationSteps) settleBlock(block);
+				blockActive[block] = 1;
+			}
+		}
+
+		inline bool depositsNeedPreparation()
+		{
+			return layout == TILED || evaporationMode == LAZY_EVAPORATION;
+		}
+
+		inline uint8_t* depositTarget(int channel, int x, int y)
+		{
+			if(layout == TILED) return tiles[tileIndex(x, y)] + tileOffset(x, y) + channel;
+			return cell(channel, (size_t)y * width + x);
+		}
+
+		inline void deposit(int channel, int x, int y, int amount)
+		{
+			prepareDeposit(x, y);
+
+			uint8_t* value = depositTarget(channel, x, y);
+			*value = std::min((int)*value + amount, 255);
+
+			if(layout == TILED)
+			{
+				int tile = tileIndex(x, y);
+				tilePeak[tile] = std::max(tilePeak[tile], *value);
+			}
+		}
+
+		// Same saturating add, callable from many threads at once on prepared cells.
+		// Saturating adds of non negative amounts commute, min(min(v + a, 255) + b, 255)
+		// = min(v + a + b, 255), so the field does not depend on the order the
+		// threads reach a cell in.
+		inline void depositAtomic(int channel, int x, int y, int amount)
+		{
+			uint8_t value = atomicSaturatingAdd(depositTarget(channel, x, y), amount);
+			if(layout == TILED) atomicMax(&tilePeak[tileIndex(x, y)], value);
+		}
+
+		// Sum of one channel over the (2*radius+1)^2 box centered on (x, y)
+		inline int boxSum(int channel, int x, int y, int radius)
+		{
+			if(summedAreaReady) return summedAreaBoxSum(summedArea[channel], x, y, radius);
+			if(layout == TILED || evaporationMode == LAZY_EVAPORATION)
+			{
+				PheromoneReading reading = boxSums(x, y, radius);
+				return channel == RED ? reading.red : channel == GREEN ? reading.green : reading.blue;
+			}
+			if(pixelStride == 4) return boxSumStrided<4>(channels[channel], x, y, radius);
+			return boxSumStrided<1>(channels[channel], x, y, radius);
+		}
+
+		// Sums of R, G and B over the same box, walking it once
+		inline PheromoneReading boxSums(int x, int y, int radius)
+		{
+			if(summedAreaReady)
+			{
+				PheromoneReading reading;
+				reading.red = summedAreaBoxSum(summedArea[RED], x, y, radius);
+				reading.green = summedAreaBoxSum(summedArea[GREEN], x, y, radius);
+				reading.blue = summedAreaBoxSum(summedArea[BLUE], x, y, radius);
+				return reading;
+			}
+			if(layout == TILED) return boxSumsTiled(x, y, radius);
+			if(evaporationMode == LAZY_EVAPORATION) return boxSumsLazy(x, y, radius);
+			if(pixelStride == 4) return boxSumsInterleaved(x, y, radius);
+			return boxSumsPlanar(x, y, radius);
+		}
+
+		// One saturating decrement of every R, G and B value, only counted when lazy
+		void evaporate(ThreadPool* threadPool);
+
+		// Applies the pending lazy steps to every block, nothing to do when eager
+		void settle(ThreadPool* threadPool);
+		void settleBlock(size_t block);
+
+		// Builds the summed area tables of the current field, box sums then take four
+		// lookups until invalidateSummedArea is called. The field must not change
+		// in between. Not available on the tiled layout, the tables would be as
+		// large as the world.
+		void buildSummedArea(ThreadPool* threadPool);
+		void invalidateSummedArea();
+
+		// Writes the field as RGBA with alpha 255, the texture layout
+		void exportRGBA(uint8_t* rgba);
+		// Writes one PHEROMONE_TILE_SIZE tile of the field into a whole RGBA frame
+		void exportTileRGBA(int tile, uint8_t* rgba);
+		// Tiles that may hold pheromone, read after settle. False when the layout
+		// does not keep track of them, eager dense fields may hold it anywhere.
+		bool occupiedTiles(std::vector<int>& occupied);
+
+		// Sum of one channel over the whole field
+		uint64_t total(int channel, ThreadPool* threadPool);
+		// Bytes currently allocated for the field itself
+		size_t memoryUsage();
+
+	private:
+		void pointChannels();
+
+		static inline uint8_t atomicSaturatingAdd(uint8_t* value, int amount)
+		{
+			uint8_t current = __atomic_load_n(value, __ATOMIC_RELAXED);
+
+			// A saturated cell, like the anthill cell under thousands of ants, only
+			// costs a load
+			while(current != 255 && amount > 0)
+			{
+				uint8_t updated = (uint8_t)std::min((int)current + amount, 255);
+				if(__atomic_compare_exchange_n(value, &current, updated, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) return updated;
+			}
+			return current;
+		}
+
+		static inline void atomicMax(uint8_t* value, uint8_t candidate)
+		{
+			uint8_t current = __atomic_load_n(value, __ATOMIC_RELAXED);
+			while(current < candidate && !__atomic_compare_exchange_n(value, &current, candidate, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+		}
+
+		inline int summedAreaBoxSum(const uint32_t* table, int x, int y, int radius)
+		{
+			size_t tableWidth = (size_t)width + 1;
+			size_t top = (size_t)(y - radius) * tableWidth;
+			size_t bottom = (size_t)(y + radius + 1) * tableWidth;
+			int left = x - radius;
+			int right = x + radius + 1;
+
+			return (int)(table[bottom + right] - table[top + right] - table[bottom + left] + table[top + left]);
+		}
+
+		template <int STRIDE>
+		void buildSummedAreaRows(int begin, int end);
+
+		inline PheromoneReading boxSumsLazy(int x, int y, int radius)
+		{
+			PheromoneReading reading = {0, 0, 0};
+
+			for(int i = -radius; i <= radius; i++)
+			{
+				size_t row = (size_t)(y + i) * width;
+				for(int j = -radius; j <= radius; j++)
+				{
+					size_t index = row + x + j;
+					int pending = (int)std::min(evaporationSteps - blockStep[blockIndex(x + j, y + i)], 255u);
+
+					reading.red += std::max((int)*cell(RED, index) - pending, 0);
+					reading.green += std::max((int)*cell(GREEN, index) - pending, 0);
+					reading.blue += std::max((int)*cell(BLUE, index) - pending, 0);
+				}
+			}
+
+			return reading;
+		}
+
+		inline PheromoneReading boxSumsTiled(int x, int y, int radius)
+		{
+			PheromoneReading reading = {0, 0, 0};
+
+			for(int i = -radius; i <= radius; i++)
+			{
+				int tileRow = ((y + i) >> PHEROMONE_TILE_SHIFT) * tilesX;
+
+				// Walks the row one tile at a time, missing tiles add nothing
+				for(int column = x - radius; column <= x + radius;)
+				{
+					int segmentEnd = std::min(x + radius, column | (PHEROMONE_TILE_SIZE - 1));
+					const uint8_t* tile = tiles[tileRow + (column >> PHEROMONE_TILE_SHIFT)];
+
+					if(tile != NULL)
+					{
+						const uint8_t* pixel = tile + tileOffset(column, y + i);
+						for(int j = 0; j <= segmentEnd - column; j++)
+						{
+							reading.red += pixel[j * 4 + RED];
+							reading.green += pixel[j * 4 + GREEN];
+							reading.blue += pixel[j * 4 + BLUE];
+						}
+					}
+					column = segmentEnd + 1;
+				}
+			}
+
+			return reading;
+		}
+
+		inline PheromoneReading boxSumsInterleaved(int x, int y, int radius)
+		{
+			PheromoneReading reading = {0, 0, 0};
+
+			for(int i = -radius; i <= radius; i++)
+			{
+				const uint8_t* row = data + ((size_t)(y + i) * width + x) * 4;
+				for(int j = -radius; j <= radius; j++)
+				{
+					reading.red += row[j * 4 + RED];
+					reading.green += row[j * 4 + GREEN];
+					reading.blue += row[j * 4 + BLUE];
+				}
+			}
+
+			return reading;
+		}
+
+		inline PheromoneReading boxSumsPlanar(int x, int y, int radius)
+		{
+			PheromoneReading reading = {0, 0, 0};
+
+			for(int i = -radius; i <= radius; i++)
+			{
+				size_t row = (size_t)(y + i) * width + x;
+				const uint8_t* red = channels[RED] + row;
+				const uint8_t* green = channels[GREEN] + row;
+				const uint8_t* blue = channels[BLUE] + row;
+
+				for(int j = -radius; j <= radius; j++)
+				{
+					reading.red += red[j];
+					reading.green += green[j];
+					reading.blue += blue[j];
+				}
+			}
+
+			return reading;
+		}
+
+		template <int STRIDE>
+		inline int boxSumStrided(const uint8_t* channel, int x, int y, int radius)
+		{
+			int sum = 0;
+
+			for(int i = -radius; i <= radius; i++)
+			{
+				const uint8_t* row = channel + ((size_t)(y + i) * width + x) * STRIDE;
+				for(int j = -radius; j <= radius; j++)
+					sum += row[j * STRIDE];
+			}
+
+			return sum;
+		}
+};
+
+#endif
@@ -0,0 +1,164 @@
+#ifndef PHEROMONERECORDER_H
+#define PHEROMONERECORDER_H
+
+#include <pheromoneMatrix.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+using namespace std;
+
+// Pheromone time series file: a header, one record per dumped frame, an index
+// of the frames and a footer pointing at the index. A frame is the field as
+// exportRGBA writes it, cut in PHEROMONE_TILE_SIZE square tiles.
+//
+// Every keyframeInterval-th frame is a keyframe, stored against the empty
+// field. The frames in between are stored against their keyframe, not against
+// the previous frame, so any tick is rebuilt from two records. A record only
+// lists the tiles that differ from its reference, each tile as the XOR of the
+// two, coded as runs of zero pixels and runs of literal pixels.
+#define PHEROMONE_SERIES_MAGIC "SWARMPHR"
+#define PHEROMONE_SERIES_VERSION 1
+
+// Whole fields in flight between the simulation and the writer thread
+#define PHEROMONE_RING_FRAMES 2
+
+// Alpha 255 and no pheromone, the texture value of an empty cell
+#define EMPTY_PHEROMONE_PIXEL 0xff000000u
+
+typedef struct
+{
+	char magic[8];
+	uint32_t version;
+	int32_t width;
+	int32_t height;
+	int32_t tileSize;
+	int32_t interval;
+	int32_t keyframeInterval;
+}PheromoneSeriesHeader;
+
+// Followed by payloadBytes of changed tiles: tile index minus the previous
+// changed tile index plus one, then the pixel runs until the tile is full. A
+// run is a varint count of zero pixels, a varint count of literal pixels and
+// the literal pixels.
+typedef struct
+{
+	uint64_t tick;
+	int32_t keyframe;
+	int32_t changedTiles;
+	uint64_t payloadBytes;
+}PheromoneFrameHeader;
+
+typedef struct
+{
+	uint64_t tick;
+	uint64_t offset;
+	// Index entry of the keyframe the frame is stored against
+	int64_t keyframe;
+}PheromoneIndexEntry;
+
+typedef struct
+{
+	uint64_t indexOffset;
+	uint64_t numberOfFrames;
+	char magic[8];
+}PheromoneSeriesFooter;
+
+// Dumps the field every interval ticks. The simulation thread exports the
+// field into a free slot of a single producer single consumer ring, a writer
+// thread encodes and writes it. A frame that finds the ring full is dropped.
+// A slot keeps the frame it last held, so on the tiled and lazy fields only
+// the tiles occupied now or in that frame are exported again.
+class PheromoneRecorder
+{
+	public:
+		int interval;
+
+		// Written by the simulation thread only
+		uint64_t framesRecorded;
+		uint64_t framesDropped;
+
+	private:
+		FILE* file;
+		PheromoneSeriesHeader header;
+		vector<PheromoneIndexEntry> index;
+		size_t frameBytes;
+		int tilesX;
+		int tilesY;
+
+		uint8_t* slots[PHEROMONE_RING_FRAMES];
+		uint64_t slotTicks[PHEROMONE_RING_FRAMES];
+		// Tiles of each slot that may differ from the empty field, valid while
+		// the slot was exported by tiles
+		vector<int> slotTiles[PHEROMONE_RING_FRAMES];
+		bool slotByTiles[PHEROMONE_RING_FRAMES];
+		vector<int> occupied;
+		vector<uint8_t> tileMarks;
+		alignas(64) atomic<uint64_t> head;
+		alignas(64) atomic<uint64_t> tail;
+
+		thread writer;
+		atomic<bool> stopping;
+		mutex wakeMutex;
+		condition_variable wake;
+
+		// Writer thread state
+		uint8_t* keyframe;
+		int64_t keyframeEntry;
+		vector<uint8_t> payload;
+
+	public:
+		PheromoneRecorder(const char* path, int width, int height, int interval, int keyframeInterval);
+		~PheromoneRecorder();
+
+		bool isOpen();
+
+		// Called by the simulation thread after every tick. Lazy evaporation is
+		// settled first, the dump holds the values the ants see.
+		void record(PheromoneMatrix* pheromoneMatrix, ThreadPool* threadPool, uint64_t tick);
+
+		// Writes what is left in the ring, the index and the footer
+		void close();
+
+	private:
+		void clearTile(uint8_t* field, int tile);
+		void writerLoop();
+		void writeFrame(const uint8_t* field, uint64_t tick);
+};
+
+// Rebuilds the field at any dumped tick through the index
+class PheromoneReader
+{
+	public:
+		PheromoneSeriesHeader header;
+		vector<PheromoneIndexEntry> index;
+
+	private:
+		FILE* file;
+		// Last keyframe decoded, the frames after it only add their own record
+		vector<uint8_t> keyframe;
+		int64_t keyframeEntry;
+		vector<uint8_t> payload;
+
+	public:
+		PheromoneReader();
+		~PheromoneReader();
+
+		bool open(const char* path);
+		size_t frameBytes();
+
+		// Last frame at or before tick, the first frame before the first tick
+		int findFrame(uint64_t tick);
+
+		// Writes frame as RGBA, width x height pixels
+		bool readFrame(int frame, uint8_t* rgba);
+
+	private:
+		bool applyRecord(int64_t entry, uint8_t* rgba);
+};
+
+#endif
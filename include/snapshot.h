@@ -0,0 +1,85 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <antSwarm.h>
+#include <cstdint>
+
+// Binary image of a whole Environment: pheromone field, ants, nests, food
+// sources and the tick. Every large array is stored as it lies in memory in
+// its own page aligned section, so a restore maps the file and points the
+// environment at the sections instead of parsing them. The mapping is private,
+// the first write to a page copies it and the file itself never changes.
+//
+// Fields are native endian and sized for 64 bit Linux, the version goes up with
+// any change of the layout.
+#define SNAPSHOT_MAGIC "SWARMSNP"
+#define SNAPSHOT_VERSION 1
+#define SNAPSHOT_ALIGNMENT 4096
+
+// Arrays of the FLOAT_ANTS storage with the species array, the most of any storage
+#define SNAPSHOT_MAX_ANT_ARRAYS 9
+
+enum SnapshotSectionType
+{
+	SNAPSHOT_PHEROMONE,     // PheromoneMatrix::data, or the active tiles one after the other
+	SNAPSHOT_TILE_INDICES,  // int32 index of each active tile
+	SNAPSHOT_TILE_PEAKS,    // peak of each active tile
+	SNAPSHOT_BLOCK_STEPS,   // lazy evaporation step of each block
+	SNAPSHOT_BLOCK_ACTIVE,
+	SNAPSHOT_SPECIES,       // SnapshotSpecies
+	SNAPSHOT_NESTS,         // SnapshotLandmark
+	SNAPSHOT_FOODS,         // SnapshotLandmark
+	SNAPSHOT_ANT_ARRAYS,    // first of SNAPSHOT_MAX_ANT_ARRAYS, in AntSwarm::forEachArray order
+	NUMBER_OF_SNAPSHOT_SECTIONS = SNAPSHOT_ANT_ARRAYS + SNAPSHOT_MAX_ANT_ARRAYS
+};
+
+typedef struct
+{
+	uint64_t offset;
+	uint64_t bytes;
+}SnapshotSection;
+
+typedef struct
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t headerBytes;
+
+	// Only restored into an environment of the same world and storage
+	int32_t width;
+	int32_t height;
+	int32_t layout;
+	int32_t evaporationMode;
+	int32_t antStorage;
+	uint32_t globalSeed;
+
+	uint64_t tick;
+	uint32_t evaporationSteps;
+	int32_t numberOfAnts;
+	int32_t numberOfNests;
+	int32_t numberOfFoods;
+	int32_t numberOfSpecies;
+	int32_t numberOfActiveTiles;
+
+	SnapshotSection sections[NUMBER_OF_SNAPSHOT_SECTIONS];
+}SnapshotHeader;
+
+// The antParameters pointer is fixed up from antParametersIndex, -1 when the
+// species did not come from the ParameterAssigner
+typedef struct
+{
+	int32_t antParametersIndex;
+	AntSpecies species;
+}SnapshotSpecies;
+
+// A nest keeps its antAmount in amount, a food source its foodAmount
+typedef struct
+{
+	int32_t id;
+	float posX;
+	float posY;
+	float size;
+	int32_t amount;
+}SnapshotLandmark;
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <cstdint>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// Body of a parallel loop, called with a [begin, end) sub range and the index
+// of the thread running it
+typedef function<void(int begin, int end, int threadIndex)> ParallelForBody;
+
+// Range of chunks owned by one thread. The owner pops chunks from the front,
+// idle threads steal from the back, both through a CAS on the packed pair.
+struct alignas(64) ChunkQueue
+{
+	atomic<uint64_t> frontBack;
+};
+
+// Persistent pool of worker threads. The calling thread always takes part as
+// thread 0, so a pool of N threads starts N-1 workers.
+class ThreadPool
+{
+	public:
+		int numberOfThreads;
+
+	private:
+		vector<thread> workers;
+		vector<ChunkQueue> queues;
+
+		mutex jobMutex;
+		condition_variable jobStart;
+		condition_variable jobDone;
+		unsigned long jobGeneration;
+		int runningWorkers;
+		bool stopping;
+
+		const ParallelForBody* jobBody;
+		int jobBegin;
+		int jobEnd;
+		int jobChunkSize;
+
+	public:
+		ThreadPool(int numberOfThreads);
+		~ThreadPool();
+
+		// Splits [begin, end) in chunks of chunkSize elements and runs body over
+		// all of them, returning once every chunk is done
+		void parallelFor(int begin, int end, int chunkSize, const ParallelForBody& body);
+
+		static int defaultNumberOfThreads();
+
+	private:
+		void workerLoop(int threadIndex);
+		void runChunks(int threadIndex);
+		bool popChunk(int queueIndex, bool steal, int* chunk);
+};
+
+#endif
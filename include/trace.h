@@ -0,0 +1,56 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// Scoped timers for the hot path, written as Chrome trace events that open in
+// chrome://tracing or ui.perfetto.dev. Everything compiles to nothing unless
+// the build defines SWARM_TRACE (make TRACE=1).
+//
+//   TRACE_SCOPE("Environment::run");   times the enclosing scope
+//   TRACE_WRITE("trace.json");         writes every thread's events, call it
+//                                      once the threads are idle
+#ifdef SWARM_TRACE
+
+#include <chrono>
+#include <cstdint>
+
+// Each thread keeps its latest events in a ring of this size
+#define TRACE_EVENTS_PER_THREAD (1 << 20)
+
+typedef struct
+{
+	const char* name;
+	uint64_t start;
+	uint64_t duration;
+}TraceEvent;
+
+inline uint64_t traceNow()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void traceRecord(const char* name, uint64_t start, uint64_t end);
+void traceWrite(const char* path);
+
+class TraceScope
+{
+	public:
+		const char* name;
+		uint64_t start;
+
+		TraceScope(const char* name) : name(name), start(traceNow()) {}
+		~TraceScope() { traceRecord(name, start, traceNow()); }
+};
+
+#define TRACE_CONCAT_(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_(a, b)
+#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope, __LINE__)(name)
+#define TRACE_WRITE(path) traceWrite(path)
+
+#else
+
+#define TRACE_SCOPE(name)
+#define TRACE_WRITE(path)
+
+#endif
+
+#endif
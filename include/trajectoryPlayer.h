@@ -0,0 +1,88 @@
+#ifndef TRAJECTORYPLAYER_H
+#define TRAJECTORYPLAYER_H
+
+#include <environment.h>
+
+#include <memory>
+
+// Chunks kept decoded past the one being shown, in the direction of playback
+#define REPLAY_READ_AHEAD_CHUNKS 2
+
+// Decoded chunk, frame f holds the values [frameBegin[f], frameBegin[f] +
+// frames[f].numberOfAnts) of each column. No frames when it failed to decode.
+typedef struct
+{
+	int chunk;
+	vector<TrajectoryFrame> frames;
+	vector<size_t> frameBegin;
+	vector<uint8_t> columns[TRAJECTORY_COLUMNS];
+}TrajectoryChunk;
+
+// Plays a trajectory file and a pheromone series back into an Environment that
+// is only drawn, never run. A loader thread keeps the chunk of the playback
+// position and the next ones decoded, so the render loop copies the frame it
+// shows into the ant arrays and never waits for the disk. The pheromone frame
+// is rebuilt on the render thread when the position reaches another one, from
+// the cached keyframe and one record.
+//
+// Either file may be missing, the playback range covers both.
+class TrajectoryPlayer
+{
+	public:
+		TrajectoryReader reader;
+		PheromoneReader pheromoneReader;
+		uint64_t firstTick;
+		uint64_t lastTick;
+
+		// Tick being shown, fractional so that slow speeds still move
+		double position;
+		// Ticks per second, negative plays backwards
+		double speed;
+		bool playing;
+
+	private:
+		ThreadPool* decodePool;
+		thread loader;
+
+		// Shared with the loader thread
+		mutex cacheMutex;
+		condition_variable wake;
+		bool stopping;
+		int wantedChunk;
+		int direction;
+		vector<shared_ptr<TrajectoryChunk>> cache;
+
+		// Frame the ant arrays hold
+		int shownChunk;
+		int shownFrame;
+
+		bool hasPheromones;
+		int shownPheromoneFrame;
+
+	public:
+		TrajectoryPlayer();
+		~TrajectoryPlayer();
+
+		// Paths may be empty, false when neither file opens
+		bool open(const char* trajectoryPath, const char* pheromonePath);
+		void close();
+		bool isOpen();
+
+		// Moves the position by seconds of playback, stops at either end
+		void advance(double seconds);
+		void seek(uint64_t tick);
+
+		// Copies the last frame at or before the position into the ants of
+		// environment, false while its chunk is still being decoded. The ants
+		// take the storage of the file and the first species of the experiment.
+		// The field becomes an eager INTERLEAVED_RGBA one, the layout of the
+		// series.
+		bool showFrame(Environment* environment);
+
+	private:
+		void showPheromones(Environment* environment);
+		void loaderLoop();
+		shared_ptr<TrajectoryChunk> decode(int chunk);
+};
+
+#endif
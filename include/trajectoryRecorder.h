@@ -0,0 +1,177 @@
+#ifndef TRAJECTORYRECORDER_H
+#define TRAJECTORYRECORDER_H
+
+#include <antSwarm.h>
+#include <threadPool.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+// Trajectory file: a header, chunks of up to TRAJECTORY_FRAMES_PER_CHUNK
+// frames, an index of the chunks and a footer pointing at the index. A frame is
+// the position, heading and state of every ant at one tick, as the storage in
+// use keeps them. Inside a chunk each column is one stream of every frame, so
+// a reader only decodes the columns it wants, and each chunk starts from a key
+// frame, so it decodes without the chunks before it.
+//
+// A value is stored as the difference to the same ant in the previous frame of
+// the chunk, zigzag and varint coded, with runs of zeros as one zero and the
+// run length. Floats are differenced as their bit patterns, which stays exact
+// and small while an ant moves within one binade.
+#define TRAJECTORY_MAGIC "SWARMTRJ"
+#define TRAJECTORY_VERSION 1
+#define TRAJECTORY_FRAMES_PER_CHUNK 32
+
+// Frames in flight between the simulation and the writer thread, each slot
+// holds a whole frame (13 bytes per float ant, 7 per compact ant)
+#define TRAJECTORY_RING_FRAMES 4
+
+// THROTTLE_FRAMES widens the interval up to this many times the configured one
+#define TRAJECTORY_MAX_THROTTLE 64
+
+enum TrajectoryColumn
+{
+	TRAJECTORY_POS_X,
+	TRAJECTORY_POS_Y,
+	TRAJECTORY_HEADING,
+	TRAJECTORY_STATE,
+	TRAJECTORY_COLUMNS
+};
+
+typedef struct
+{
+	char magic[8];
+	uint32_t version;
+	int32_t antStorage;
+	// Bytes of one value of each column, 4 4 4 1 for float ants, 2 2 2 1 for
+	// compact ants whose state column holds the packed flags
+	int32_t valueBytes[TRAJECTORY_COLUMNS];
+	int32_t interval;
+	int32_t reserved;
+}TrajectoryHeader;
+
+// Followed by numberOfFrames TrajectoryFrame, then the column streams in order
+typedef struct
+{
+	int32_t numberOfFrames;
+	int32_t reserved;
+	uint64_t columnBytes[TRAJECTORY_COLUMNS];
+}TrajectoryChunkHeader;
+
+typedef struct
+{
+	uint64_t tick;
+	int32_t numberOfAnts;
+	int32_t reserved;
+}TrajectoryFrame;
+
+typedef struct
+{
+	uint64_t firstTick;
+	uint64_t lastTick;
+	uint64_t offset;
+}TrajectoryIndexEntry;
+
+typedef struct
+{
+	uint64_t indexOffset;
+	uint64_t numberOfChunks;
+	char magic[8];
+}TrajectoryFooter;
+
+// Raw columns of one frame
+typedef struct
+{
+	uint64_t tick;
+	int numberOfAnts;
+	int capacity;
+	uint8_t* columns[TRAJECTORY_COLUMNS];
+}TrajectorySlot;
+
+// Records the ants every interval ticks. The simulation thread copies the
+// columns into a single producer single consumer ring and returns, a writer
+// thread encodes and writes them. When the writer falls behind the ring fills
+// up and the policy decides: DROP_FRAMES skips frames until a slot is free,
+// THROTTLE_FRAMES also doubles the interval, and halves it back each time it
+// finds the ring drained.
+class TrajectoryRecorder
+{
+	public:
+		TrajectoryPolicy policy;
+		int interval;
+		int throttle;
+
+		// Written by the simulation thread only
+		uint64_t framesRecorded;
+		uint64_t framesDropped;
+
+	private:
+		FILE* file;
+		TrajectoryHeader header;
+		vector<TrajectoryIndexEntry> index;
+
+		TrajectorySlot slots[TRAJECTORY_RING_FRAMES];
+		alignas(64) atomic<uint64_t> head;
+		alignas(64) atomic<uint64_t> tail;
+
+		thread writer;
+		atomic<bool> stopping;
+		mutex wakeMutex;
+		condition_variable wake;
+
+		// Writer thread state, the chunk being built and the previous frame
+		vector<TrajectoryFrame> chunkFrames;
+		vector<uint8_t> streams[TRAJECTORY_COLUMNS];
+		vector<uint8_t> previous[TRAJECTORY_COLUMNS];
+		int previousAnts;
+		uint64_t zeroRuns[TRAJECTORY_COLUMNS];
+
+	public:
+		TrajectoryRecorder(const char* path, AntStorage antStorage, int interval, TrajectoryPolicy policy);
+		~TrajectoryRecorder();
+
+		bool isOpen();
+
+		// Called by the simulation thread after every tick
+		void record(AntSwarm* ants, uint64_t tick);
+
+		// Writes what is left in the ring, the index and the footer
+		void close();
+
+	private:
+		void writerLoop();
+		void encodeFrame(TrajectorySlot* slot);
+		void writeChunk();
+};
+
+// Random access to a trajectory file through its index
+class TrajectoryReader
+{
+	public:
+		TrajectoryHeader header;
+		vector<TrajectoryIndexEntry> index;
+
+	private:
+		FILE* file;
+
+	public:
+		TrajectoryReader();
+		~TrajectoryReader();
+
+		bool open(const char* path);
+
+		// Chunk holding tick, or the first chunk after it, -1 past the end
+		int findChunk(uint64_t tick);
+
+		// Decodes the frames of one chunk. columns[c] receives the values of
+		// column c of every frame one after the other, for the columns whose bit
+		// is set in columnMask, the other streams are skipped. With a thread pool
+		// the columns decode in parallel.
+		bool readChunk(int chunk, vector<TrajectoryFrame>& frames, vector<uint8_t> columns[TRAJECTORY_COLUMNS], unsigned columnMask = (1u << TRAJECTORY_COLUMNS) - 1, ThreadPool* threadPool = NULL);
+};
+
+#endif
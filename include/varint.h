@@ -0,0 +1,32 @@
+#ifndef VARINT_H
+#define VARINT_H
+
+#include <cstdint>
+#include <vector>
+
+// LEB128 unsigned integers, 7 bits per byte with the high bit set on every byte
+// but the last, shared by the recorders
+
+static inline void putVarint(std::vector<uint8_t>& stream, uint64_t value)
+{
+	while(value >= 0x80)
+	{
+		stream.push_back((uint8_t)(value | 0x80));
+		value >>= 7;
+	}
+	stream.push_back((uint8_t)value);
+}
+
+static inline bool getVarint(const uint8_t*& cursor, const uint8_t* end, uint64_t& value)
+{
+	value = 0;
+	for(int shift = 0; shift < 64 && cursor < end; shift += 7)
+	{
+		uint8_t byte = *cursor++;
+		value |= (uint64_t)(byte & 0x7F) << shift;
+		if(byte < 0x80) return true;
+	}
+	return false;
+}
+
+#endif
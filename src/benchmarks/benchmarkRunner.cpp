@@ -0,0 +1,121 @@
+#include <benchmarkRunner.h>
+
+#include "extern/rapidjson/prettywriter.h"
+#include "extern/rapidjson/stringbuffer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+
+BenchmarkRunner::BenchmarkRunner(int repetitions, string filter)
+{
+	this->repetitions = max(repetitions, 1);
+	this->filter = filter;
+}
+
+bool BenchmarkRunner::selected(string name)
+{
+	return filter.empty() || name.find(filter) != string::npos;
+}
+
+void BenchmarkRunner::run(string name, int ants, int gridSize, double items, double bytes, function<void()> body, function<void()> setup)
+{
+	if(!selected(name)) return;
+
+	vector<double> seconds;
+	if(setup) setup();
+	body();
+
+	for(int r = 0; r < repetitions; r++)
+	{
+		if(setup) setup();
+		auto start = chrono::steady_clock::now();
+		body();
+		seconds.push_back(chrono::duration<double>(chrono::steady_clock::now() - start).count());
+	}
+
+	BenchmarkResult result;
+	result.name = name;
+	result.ants = ants;
+	result.gridSize = gridSize;
+	result.repetitions = repetitions;
+	result.items = items;
+	result.bytes = bytes;
+
+	double sum = 0, squares = 0;
+	for(double s : seconds) sum += s;
+	result.meanSeconds = sum / repetitions;
+	for(double s : seconds) squares += (s - result.meanSeconds) * (s - result.meanSeconds);
+	result.stddevSeconds = repetitions > 1 ? sqrt(squares / (repetitions - 1)) : 0;
+	result.minSeconds = *min_element(seconds.begin(), seconds.end());
+	result.maxSeconds = *max_element(seconds.begin(), seconds.end());
+
+	results.push_back(result);
+
+	printf("%-32s ants %8d grid %5d  %10.3f ms +- %5.1f%%  %8.2f ns/item", name.c_str(), ants, gridSize,
+		result.meanSeconds * 1e3, 100.0 * result.stddevSeconds / result.meanSeconds, result.meanSeconds * 1e9 / items);
+	if(bytes > 0) printf("  %7.2f GB/s", bytes / result.meanSeconds * 1e-9);
+	printf("\n");
+	fflush(stdout);
+}
+
+void BenchmarkRunner::record(string name, double value)
+{
+	if(!selected(name)) return;
+
+	metrics.push_back({name, value});
+	printf("%-32s %g\n", name.c_str(), value);
+	fflush(stdout);
+}
+
+void BenchmarkRunner::writeJSON(const char* path, int numberOfThreads, const char* simdLevel)
+{
+	rapidjson::StringBuffer buffer;
+	rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+
+	writer.StartObject();
+	writer.Key("timestamp"); writer.Int64((int64_t)time(NULL));
+	writer.Key("numberOfThreads"); writer.Int(numberOfThreads);
+	writer.Key("simdLevel"); writer.String(simdLevel);
+	writer.Key("repetitions"); writer.Int(repetitions);
+
+	writer.Key("results");
+	writer.StartArray();
+	for(BenchmarkResult& result : results)
+	{
+		writer.StartObject();
+		writer.Key("name"); writer.String(result.name.c_str());
+		writer.Key("ants"); writer.Int(result.ants);
+		writer.Key("gridSize"); writer.Int(result.gridSize);
+		writer.Key("items"); writer.Double(result.items);
+		writer.Key("meanSeconds"); writer.Double(result.meanSeconds);
+		writer.Key("stddevSeconds"); writer.Double(result.stddevSeconds);
+		writer.Key("minSeconds"); writer.Double(result.minSeconds);
+		writer.Key("maxSeconds"); writer.Double(result.maxSeconds);
+		writer.Key("coefficientOfVariation"); writer.Double(result.stddevSeconds / result.meanSeconds);
+		writer.Key("nsPerItem"); writer.Double(result.meanSeconds * 1e9 / result.items);
+		// Ant benchmarks count one ant over one tick as an item
+		if(result.ants > 0) { writer.Key("nsPerAnt"); writer.Double(result.meanSeconds * 1e9 / result.items); }
+		if(result.bytes > 0) { writer.Key("gigabytesPerSecond"); writer.Double(result.bytes / result.meanSeconds * 1e-9); }
+		writer.EndObject();
+	}
+	writer.EndArray();
+
+	writer.Key("metrics");
+	writer.StartArray();
+	for(BenchmarkMetric& metric : metrics)
+	{
+		writer.StartObject();
+		writer.Key("name"); writer.String(metric.name.c_str());
+		writer.Key("value"); writer.Double(metric.value);
+		writer.EndObject();
+	}
+	writer.EndArray();
+	writer.EndObject();
+
+	ofstream file(path);
+	file << buffer.GetString() << endl;
+}
@@ -0,0 +1,469 @@
+#include <benchmarkRunner.h>
+#include <environment.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Benchmarks of the simulation kernels and of whole ticks, written as JSON so
+// the numbers can be tracked from one commit to the next.
+//
+// usage: swarm_bench [--experiment <json>] [--output <json>] [--repetitions <n>] [--filter <name part>] [--quick]
+
+static const int GRID_SIZES[] = {500, 2000, 8000};
+static const int ANT_COUNTS[] = {1000, 10000, 100000, 1000000, 5000000};
+
+// Every timed call of an ant benchmark simulates about this many ant ticks, so
+// small swarms run several ticks per call and the timer resolution stays out
+static const double ANT_TICKS_PER_CALL = 1e6;
+
+static const int SENSOR_READS = 1 << 20;
+static const int TRIG_ANGLES = 1 << 20;
+
+// Grid kernels repeat until a call covers about this many cells, at most
+// PHEROMONE_STEPS_PER_CALL times so a filled field never runs dry within a call
+static const double CELLS_PER_CALL = 16e6;
+static const int PHEROMONE_STEPS_PER_CALL = 64;
+
+static int stepsPerCall(int gridSize)
+{
+	return max(1, min(PHEROMONE_STEPS_PER_CALL, (int)(CELLS_PER_CALL / ((double)gridSize * gridSize))));
+}
+
+static void fillField(PheromoneMatrix* pheromoneMatrix, int trailPercent)
+{
+	// A band over trailPercent of the rows, values high enough to survive every
+	// repetition of the evaporation benchmarks
+	int rows = pheromoneMatrix->height * trailPercent / 100;
+	for(int y = 0; y < rows; y++)
+		for(int x = 0; x < pheromoneMatrix->width; x++)
+			for(int c = 0; c < PHEROMONE_CHANNELS; c++) pheromoneMatrix->deposit(c, x, y, 200);
+}
+
+static void benchmarkEvaporationKernels(BenchmarkRunner* runner, int gridSize)
+{
+	size_t bytes = (size_t)gridSize * gridSize * 4;
+	uint8_t* data = (uint8_t*)aligned_alloc(64, (bytes + 63) & ~(size_t)63);
+	memset(data, 200, bytes);
+	int steps = stepsPerCall(gridSize);
+
+	for(int level = SIMD_SCALAR; level <= detectSimdLevel(); level++)
+	{
+		string name = string("evaporatePheromone/") + simdLevelName((SimdLevel)level);
+		runner->run(name, 0, gridSize, (double)gridSize * gridSize * steps, 2.0 * bytes * steps, [&]
+		{
+			for(int s = 0; s < steps; s++) evaporatePheromone(data, bytes, EVAPORATION_PATTERN_RGBA, (SimdLevel)level);
+		},
+		[&]
+		{
+			memset(data, 200, bytes);
+		});
+	}
+
+	free(data);
+}
+
+static void benchmarkPheromoneMatrix(BenchmarkRunner* runner, ThreadPool* threadPool, int gridSize, int sensorPixelRadius)
+{
+	struct {const char* name; PheromoneLayout layout; EvaporationMode evaporationMode; int trailPercent;} variants[] =
+	{
+		{"interleaved", INTERLEAVED_RGBA, EAGER_EVAPORATION, 100},
+		{"planar", PLANAR, EAGER_EVAPORATION, 100},
+		{"lazy", INTERLEAVED_RGBA, LAZY_EVAPORATION, 5},
+		{"tiled", TILED, EAGER_EVAPORATION, 5}
+	};
+	double cells = (double)gridSize * gridSize;
+	int steps = stepsPerCall(gridSize);
+
+	for(auto& variant : variants)
+	{
+		string suffix = string("/") + variant.name;
+		if(!runner->selected("evaporate" + suffix) && !runner->selected("boxSums/direct" + suffix) &&
+			!runner->selected("buildSummedArea" + suffix) && !runner->selected("boxSums/summedArea" + suffix)) continue;
+
+		PheromoneMatrix pheromoneMatrix(gridSize, gridSize, variant.layout, variant.evaporationMode);
+		auto refill = [&]
+		{
+			pheromoneMatrix.clear();
+			fillField(&pheromoneMatrix, variant.trailPercent);
+		};
+		refill();
+
+		// Lazy steps are paid when the field is settled for the frame, so both are timed.
+		// Bandwidth is only reported where every byte of the field is streamed.
+		double bytes = variant.evaporationMode == LAZY_EVAPORATION ? 0 : 2.0 * pheromoneMatrix.memoryUsage() * steps;
+		runner->run("evaporate" + suffix, 0, gridSize, cells * steps, bytes, [&]
+		{
+			for(int s = 0; s < steps; s++)
+			{
+				pheromoneMatrix.evaporate(threadPool);
+				pheromoneMatrix.settle(threadPool);
+			}
+		}, refill);
+		refill();
+
+		// Sensor reads at random cells away from the border
+		vector<int> xs(SENSOR_READS), ys(SENSOR_READS);
+		CounterRandom random(GLOBAL_SEED, 0, 0, SPAWN_STREAM);
+		int span = gridSize - 2 * sensorPixelRadius - 2;
+		for(int i = 0; i < SENSOR_READS; i++)
+		{
+			xs[i] = sensorPixelRadius + 1 + random.next() % span;
+			ys[i] = sensorPixelRadius + 1 + random.next() % span;
+		}
+
+		int side = 2 * sensorPixelRadius + 1;
+		volatile int sink = 0;
+		auto readAll = [&]
+		{
+			int sum = 0;
+			for(int i = 0; i < SENSOR_READS; i++) sum += pheromoneMatrix.boxSums(xs[i], ys[i], sensorPixelRadius).red;
+			sink = sum;
+		};
+
+		runner->run("boxSums/direct" + suffix, 0, gridSize, SENSOR_READS, (double)SENSOR_READS * side * side * 3, readAll);
+
+		if(variant.layout == TILED) continue;
+
+		// The row pass reads the field and writes the tables, the column pass reads
+		// two table rows and writes one
+		runner->run("buildSummedArea" + suffix, 0, gridSize, cells, cells * (4 + 16 * PHEROMONE_CHANNELS), [&]
+		{
+			pheromoneMatrix.buildSummedArea(threadPool);
+		});
+
+		pheromoneMatrix.buildSummedArea(threadPool);
+		runner->run("boxSums/summedArea" + suffix, 0, gridSize, SENSOR_READS, (double)SENSOR_READS * 4 * 4 * PHEROMONE_CHANNELS, readAll);
+		pheromoneMatrix.invalidateSummedArea();
+	}
+}
+
+static void benchmarkTrig(BenchmarkRunner* runner)
+{
+	// Headings and headings plus a sensor angle, up to half a turn outside [0, 2*pi)
+	CounterRandom random(GLOBAL_SEED, 0, 0, SPAWN_STREAM);
+	vector<float> angles(TRIG_ANGLES), sine(TRIG_ANGLES), cosine(TRIG_ANGLES);
+	for(float& angle : angles) angle = (float)((random.next() % 2000000) / 1e6 - 0.5) * (float)(2*M_PI);
+
+	for(TrigMode trigMode : {TABLE_TRIG, POLYNOMIAL_TRIG})
+	{
+		string name = string("sinCos/") + (trigMode == TABLE_TRIG ? "table" : "polynomial");
+
+		for(int level = SIMD_SCALAR; level <= detectSimdLevel(); level++)
+		{
+			runner->run(name + "/" + simdLevelName((SimdLevel)level), 0, 0, TRIG_ANGLES, 0, [&]
+			{
+				sinCosKernel(angles.data(), sine.data(), cosine.data(), TRIG_ANGLES, trigMode, (SimdLevel)level);
+			});
+		}
+
+		// Every level gives the same values, compared with sin and cos in double
+		if(!runner->selected(name + "/maxAbsError") && !runner->selected(name + "/meanAbsError")) continue;
+		sinCosKernel(angles.data(), sine.data(), cosine.data(), TRIG_ANGLES, trigMode, detectSimdLevel());
+		double maxError = 0, sumError = 0;
+		for(int i = 0; i < TRIG_ANGLES; i++)
+		{
+			double error = max(fabs(sine[i] - sin((double)angles[i])), fabs(cosine[i] - cos((double)angles[i])));
+			maxError = max(maxError, error);
+			sumError += error;
+		}
+		runner->record(name + "/maxAbsError", maxError);
+		runner->record(name + "/meanAbsError", sumError / TRIG_ANGLES);
+	}
+}
+
+// Every SIMD level of the ant kernels runs on the same batch as the scalar one
+// and has to give the same bits. The batch is not a multiple of any vector
+// width, so the tails are checked too.
+static const int PARITY_BATCH = 4099;
+static const int PARITY_GRID_SIZE = 1000;
+static const int PARITY_RADIUS = 3;
+
+template <typename T>
+static int countDifferences(const vector<T>& reference, const vector<T>& values)
+{
+	int differences = 0;
+	for(size_t i = 0; i < reference.size(); i++) differences += memcmp(&reference[i], &values[i], sizeof(T)) != 0;
+	return differences;
+}
+
+// Records the differing elements of each kernel and level, returns how many
+// kernel and level pairs differ from scalar
+static int checkKernelParity(BenchmarkRunner* runner, ThreadPool* threadPool)
+{
+	if(!runner->selected("simdParity")) return 0;
+
+	CounterRandom random(GLOBAL_SEED, 0, 0, SPAWN_STREAM);
+	auto uniform = [&](float low, float high) { return low + (high - low) * ((random.next() >> 8) * (1.0f / 16777216.0f)); };
+
+	vector<float> posX(PARITY_BATCH), posY(PARITY_BATCH), theta(PARITY_BATCH);
+	for(int i = 0; i < PARITY_BATCH; i++)
+	{
+		posX[i] = uniform(-0.99f, 0.99f);
+		posY[i] = uniform(-0.99f, 0.99f);
+		theta[i] = uniform(-2.0f * (float)M_PI, 4.0f * (float)M_PI);
+	}
+
+	PheromoneMatrix pheromoneMatrix(PARITY_GRID_SIZE, PARITY_GRID_SIZE, INTERLEAVED_RGBA, EAGER_EVAPORATION);
+	for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+		for(int i = 0; i < PARITY_GRID_SIZE * PARITY_GRID_SIZE / 4; i++)
+			pheromoneMatrix.deposit(c, random.next() % PARITY_GRID_SIZE, random.next() % PARITY_GRID_SIZE, random.next() % 256);
+	pheromoneMatrix.buildSummedArea(threadPool);
+
+	float half = PARITY_GRID_SIZE / 2;
+	int failures = 0;
+
+	for(TrigMode trigMode : {TABLE_TRIG, POLYNOMIAL_TRIG})
+	{
+		string trigName = trigMode == TABLE_TRIG ? "table" : "polynomial";
+		vector<float> sine[2], cosine[2], movedX[2], movedY[2];
+		vector<int> cellX[2], cellY[2];
+		vector<PheromoneReading> summedArea[2], interleaved[2];
+
+		// Slot 0 holds the scalar results, slot 1 the level being checked
+		for(int level = SIMD_SCALAR; level <= detectSimdLevel(); level++)
+		{
+			int slot = level == SIMD_SCALAR ? 0 : 1;
+			SimdLevel simdLevel = (SimdLevel)level;
+
+			sine[slot].resize(PARITY_BATCH);
+			cosine[slot].resize(PARITY_BATCH);
+			sinCosKernel(theta.data(), sine[slot].data(), cosine[slot].data(), PARITY_BATCH, trigMode, simdLevel);
+
+			movedX[slot] = posX;
+			movedY[slot] = posY;
+			moveAntsKernel(movedX[slot].data(), movedY[slot].data(), theta.data(), 0.01f, PARITY_BATCH, trigMode, simdLevel);
+
+			cellX[slot].resize(PARITY_BATCH);
+			cellY[slot].resize(PARITY_BATCH);
+			placeSensorsKernel(posX.data(), posY.data(), theta.data(), 0.012f, 0.012f, 0.7f, half, half, cellX[slot].data(), cellY[slot].data(), PARITY_BATCH, trigMode, simdLevel);
+
+			// Box sums read around the scalar cells, clamped like AntSwarm::senseBatch
+			vector<int> boxX = cellX[0], boxY = cellY[0];
+			for(int i = 0; i < PARITY_BATCH; i++)
+			{
+				boxX[i] = min(max(boxX[i], PARITY_RADIUS), PARITY_GRID_SIZE - 1 - PARITY_RADIUS);
+				boxY[i] = min(max(boxY[i], PARITY_RADIUS), PARITY_GRID_SIZE - 1 - PARITY_RADIUS);
+			}
+			summedArea[slot].resize(PARITY_BATCH);
+			summedAreaBoxSumsKernel(pheromoneMatrix.summedArea, PARITY_GRID_SIZE, PARITY_GRID_SIZE, boxX.data(), boxY.data(), PARITY_RADIUS, summedArea[slot].data(), PARITY_BATCH, simdLevel);
+			interleaved[slot].resize(PARITY_BATCH);
+			interleavedBoxSumsKernel(pheromoneMatrix.data, PARITY_GRID_SIZE, PARITY_GRID_SIZE, boxX.data(), boxY.data(), PARITY_RADIUS, interleaved[slot].data(), PARITY_BATCH, simdLevel);
+
+			if(slot == 0) continue;
+
+			string suffix = string("/") + simdLevelName(simdLevel);
+			int differences[] =
+			{
+				countDifferences(sine[0], sine[1]) + countDifferences(cosine[0], cosine[1]),
+				countDifferences(movedX[0], movedX[1]) + countDifferences(movedY[0], movedY[1]),
+				countDifferences(cellX[0], cellX[1]) + countDifferences(cellY[0], cellY[1]),
+				countDifferences(summedArea[0], summedArea[1]),
+				countDifferences(interleaved[0], interleaved[1])
+			};
+			const char* kernels[] = {"sinCos", "moveAnts", "placeSensors", "boxSums/summedArea", "boxSums/interleaved"};
+
+			for(int k = 0; k < 5; k++)
+			{
+				runner->record("simdParity/" + trigName + "/" + kernels[k] + suffix, differences[k]);
+				failures += differences[k] != 0;
+			}
+		}
+	}
+
+	return failures;
+}
+
+// Food sources spread over the world, about the size of a few pheromone cells
+static const int LANDMARKS = 20000;
+static const float LANDMARK_SIZE = 0.002f;
+
+static void benchmarkLandmarks(BenchmarkRunner* runner, int gridSize)
+{
+	if(!runner->selected("landmarks/find")) return;
+
+	CounterRandom random(GLOBAL_SEED, 0, 0, SPAWN_STREAM);
+	auto coordinate = [&] { return (float)(random.next() % 1980000) / 1e6f - 0.99f; };
+
+	vector<FoodSource*> foods;
+	for(int f = 0; f < LANDMARKS; f++)
+	{
+		FoodSourceParameters foodParameters = {f, coordinate(), coordinate(), LANDMARK_SIZE, 1};
+		foods.push_back(new FoodSource(&foodParameters));
+	}
+
+	vector<float> xs(SENSOR_READS), ys(SENSOR_READS);
+	for(int i = 0; i < SENSOR_READS; i++)
+	{
+		xs[i] = coordinate();
+		ys[i] = coordinate();
+	}
+
+	for(CollisionMode collisionMode : {INDEX_COLLISION, RASTER_COLLISION})
+	{
+		LandmarkIndex<FoodSource> foodIndex;
+		if(collisionMode == RASTER_COLLISION) foodIndex.useRaster(gridSize, gridSize);
+		for(FoodSource* food : foods) foodIndex.insert(food);
+
+		volatile int sink = 0;
+		runner->run(string("landmarks/find/") + (collisionMode == RASTER_COLLISION ? "raster" : "index"), 0, gridSize, SENSOR_READS, 0, [&]
+		{
+			int hits = 0;
+			for(int i = 0; i < SENSOR_READS; i++) hits += foodIndex.find(xs[i], ys[i]) != NULL;
+			sink = hits;
+		});
+	}
+
+	for(FoodSource* food : foods) delete food;
+}
+
+static void benchmarkEnvironment(BenchmarkRunner* runner, const char* experimentPath, int gridSize, int numberOfAnts, AntStorage antStorage)
+{
+	// Float ants keep the plain names, compact ants get a suffix
+	string suffix = antStorage == COMPACT_ANTS ? "/compact" : "";
+	bool selected = runner->selected("placePheromone" + suffix) || runner->selected("moveAnts" + suffix) || runner->selected("moveAnts/partitioned" + suffix) || runner->selected("run" + suffix);
+	selected = selected || runner->selected("snapshot/save" + suffix) || runner->selected("snapshot/load" + suffix);
+	selected = selected || (antStorage == FLOAT_ANTS && runner->selected("moveAnts/polynomial"));
+	for(int level = SIMD_SCALAR; antStorage == FLOAT_ANTS && level <= detectSimdLevel(); level++)
+		selected = selected || runner->selected(string("moveAnts/") + simdLevelName((SimdLevel)level));
+	if(!selected) return;
+
+	// The experiment sets its own world size, the grid size of the case wins
+	ParameterAssigner parameterAssigner(experimentPath);
+	setScrWidth(gridSize);
+	setScrHeight(gridSize);
+	parameterAssigner.anthillParameters[0]->antAmount = numberOfAnts;
+	parameterAssigner.environmentParameters.antStorage = antStorage;
+
+	Environment environment(&parameterAssigner);
+	environment.initializeEnvironment();
+	for(size_t i = 0; i < parameterAssigner.anthillParameters.size(); i++) environment.createNest(i);
+	for(size_t i = 0; i < parameterAssigner.foodParameters.size(); i++) environment.createFoodSource(i);
+	environment.createAnt(0);
+
+	int ticks = max(1, (int)(ANT_TICKS_PER_CALL / numberOfAnts));
+	double antTicks = (double)ticks * numberOfAnts;
+	unsigned int frameCounter = 0;
+
+	// The swarm leaves the nest before anything is timed
+	for(int t = 0; t < 2 * ticks; t++)
+	{
+		frameCounter = (frameCounter + 1) % 1000;
+		environment.run(frameCounter);
+	}
+
+	runner->run("placePheromone" + suffix, numberOfAnts, gridSize, antTicks, 0, [&]
+	{
+		for(int t = 0; t < ticks; t++) environment.placePheromone(frameCounter);
+	});
+	runner->run("moveAnts" + suffix, numberOfAnts, gridSize, antTicks, 0, [&]
+	{
+		for(int t = 0; t < ticks; t++) environment.moveAnts(frameCounter);
+	});
+	environment.updateMode = PARTITIONED_UPDATE;
+	runner->run("moveAnts/partitioned" + suffix, numberOfAnts, gridSize, antTicks, 0, [&]
+	{
+		for(int t = 0; t < ticks; t++) environment.moveAnts(frameCounter);
+	});
+	environment.updateMode = MIXED_UPDATE;
+
+	// The plain moveAnts case runs the widest level, these compare them all
+	for(int level = SIMD_SCALAR; antStorage == FLOAT_ANTS && level <= detectSimdLevel(); level++)
+	{
+		environment.simdLevel = (SimdLevel)level;
+		runner->run(string("moveAnts/") + simdLevelName((SimdLevel)level), numberOfAnts, gridSize, antTicks, 0, [&]
+		{
+			for(int t = 0; t < ticks; t++) environment.moveAnts(frameCounter);
+		});
+	}
+	environment.simdLevel = detectSimdLevel();
+
+	if(antStorage == FLOAT_ANTS)
+	{
+		environment.ants.trigMode = POLYNOMIAL_TRIG;
+		runner->run("moveAnts/polynomial", numberOfAnts, gridSize, antTicks, 0, [&]
+		{
+			for(int t = 0; t < ticks; t++) environment.moveAnts(frameCounter);
+		});
+		environment.ants.trigMode = parameterAssigner.environmentParameters.trigMode;
+	}
+	runner->run("run" + suffix, numberOfAnts, gridSize, antTicks, 0, [&]
+	{
+		for(int t = 0; t < ticks; t++)
+		{
+			frameCounter = (frameCounter + 1) % 1000;
+			environment.run(frameCounter);
+		}
+	});
+
+	// A restore maps the file, the pages are only read in as the next ticks touch them
+	const char* snapshotPath = "bench.snapshot";
+	double snapshotBytes = environment.pheromoneMatrix->memoryUsage() + (double)numberOfAnts * environment.ants.bytesPerAnt();
+	runner->run("snapshot/save" + suffix, numberOfAnts, gridSize, numberOfAnts, snapshotBytes, [&]
+	{
+		environment.saveSnapshot(snapshotPath);
+	});
+	if(runner->selected("snapshot/load" + suffix)) environment.saveSnapshot(snapshotPath);
+	runner->run("snapshot/load" + suffix, numberOfAnts, gridSize, numberOfAnts, 0, [&]
+	{
+		environment.loadSnapshot(snapshotPath);
+	});
+	remove(snapshotPath);
+}
+
+int main(int argc, char** argv)
+{
+	const char* experimentPath = "src/swarmEnvironment/experiments/experiment.json";
+	const char* outputPath = "bench.json";
+	int repetitions = 5;
+	string filter;
+	bool quick = false;
+
+	for(int i = 1; i < argc; i++)
+	{
+		if(!strcmp(argv[i], "--experiment") && i + 1 < argc) experimentPath = argv[++i];
+		else if(!strcmp(argv[i], "--output") && i + 1 < argc) outputPath = argv[++i];
+		else if(!strcmp(argv[i], "--repetitions") && i + 1 < argc) repetitions = atoi(argv[++i]);
+		else if(!strcmp(argv[i], "--filter") && i + 1 < argc) filter = argv[++i];
+		else if(!strcmp(argv[i], "--quick")) quick = true;
+		else
+		{
+			fprintf(stderr, "usage: %s [--experiment <json>] [--output <json>] [--repetitions <n>] [--filter <name part>] [--quick]\n", argv[0]);
+			return EXIT_FAILURE;
+		}
+	}
+
+	BenchmarkRunner runner(repetitions, filter);
+	ParameterAssigner parameterAssigner(experimentPath);
+	ThreadPool threadPool(parameterAssigner.environmentParameters.numberOfThreads);
+	int sensorPixelRadius = parameterAssigner.antParameters[0]->antSensorParameters->sensorPixelRadius;
+
+	// --quick drops the largest grids and swarms, for a check before a commit
+	int gridSizes = quick ? 2 : sizeof(GRID_SIZES) / sizeof(int);
+	int antCounts = quick ? 3 : sizeof(ANT_COUNTS) / sizeof(int);
+
+	int parityFailures = checkKernelParity(&runner, &threadPool);
+	benchmarkTrig(&runner);
+
+	for(int g = 0; g < gridSizes; g++)
+	{
+		benchmarkEvaporationKernels(&runner, GRID_SIZES[g]);
+		benchmarkPheromoneMatrix(&runner, &threadPool, GRID_SIZES[g], sensorPixelRadius);
+		benchmarkLandmarks(&runner, GRID_SIZES[g]);
+	}
+
+	for(int g = 0; g < gridSizes; g++)
+		for(int a = 0; a < antCounts; a++)
+			for(AntStorage antStorage : {FLOAT_ANTS, COMPACT_ANTS})
+				benchmarkEnvironment(&runner, experimentPath, GRID_SIZES[g], ANT_COUNTS[a], antStorage);
+
+	runner.writeJSON(outputPath, threadPool.numberOfThreads, simdLevelName(detectSimdLevel()));
+	printf("results written to %s\n", outputPath);
+
+	if(parityFailures > 0)
+	{
+		fprintf(stderr, "%d SIMD kernels differ from their scalar version\n", parityFailures);
+		return EXIT_FAILURE;
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,53 @@
+#include <evolutionaryAlgorithm.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Evolves the ant species of an experiment without a window, with the
+// "evolution" section of the experiment file. One CSV row per generation, the
+// best individual of the last generation is printed as the experiment fields
+// it changes.
+int main(int argc, char** argv)
+{
+    if (argc != 3)
+    {
+        fprintf(stderr, "usage: %s <experiment.json> <output.csv>\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    //=== INITIALIZATIONS ===//
+    ParameterAssigner parameterAssigner(argv[1]);
+    EvolutionaryAlgorithm evolution(&parameterAssigner, parameterAssigner.evolutionParameters);
+
+    FILE* output = fopen(argv[2], "w");
+    if (output == NULL)
+    {
+        fprintf(stderr, "could not open %s\n", argv[2]);
+        return EXIT_FAILURE;
+    }
+    fprintf(output, "generation,seed,bestFitness,meanFitness,seconds");
+    for (int g = 0; g < NUMBER_OF_GENES; g++) fprintf(output, ",%s", GENE_RANGES[g].name);
+    fprintf(output, "\n");
+
+    //=== EXECUTION LOOP ===//
+    while (evolution.generation < evolution.parameters.generations)
+    {
+        evolution.runGeneration();
+
+        GenerationResult result = evolution.results().back();
+        fprintf(output, "%d,%u,%.0f,%.2f,%.3f", result.generation, result.seed, result.bestFitness, result.meanFitness, result.seconds);
+        for (int g = 0; g < NUMBER_OF_GENES; g++) fprintf(output, ",%.9g", result.best.genes[g]);
+        fprintf(output, "\n");
+        fflush(output);
+
+        printf("generation %d: best %.0f, mean %.2f, %.3f s\n", result.generation, result.bestFitness, result.meanFitness, result.seconds);
+    }
+    fclose(output);
+    TRACE_WRITE("trace.json");
+
+    //=== OUTPUT ===//
+    printf("%s", EvolutionaryAlgorithm::describe(evolution.results().back().best).c_str());
+
+    //=== EXIT ===//
+    return EXIT_SUCCESS;
+}
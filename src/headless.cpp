@@ -0,0 +1,97 @@
+#include <environment.h>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Runs an experiment without a window: every nest, food source and ant of the
+// experiment file is created, the environment is ticked as fast as the CPU
+// allows and the final ant states are written as CSV. --load continues a
+// snapshot of the same experiment instead, --save writes one after the last tick.
+int main(int argc, char** argv)
+{
+    const char* loadPath = NULL;
+    const char* savePath = NULL;
+    bool usage = argc < 4 || argc % 2 != 0;
+    for (int i = 4; i + 1 < argc; i += 2)
+    {
+        if (!strcmp(argv[i], "--load")) loadPath = argv[i + 1];
+        else if (!strcmp(argv[i], "--save")) savePath = argv[i + 1];
+        else usage = true;
+    }
+
+    // A positive number of ticks and nothing after it
+    long long ticks = 0;
+    if (!usage)
+    {
+        char* end;
+        ticks = strtoll(argv[2], &end, 10);
+        usage = *argv[2] == '\0' || *end != '\0' || ticks <= 0;
+    }
+
+    if (usage)
+    {
+        fprintf(stderr, "usage: %s <experiment.json> <ticks> <output.csv> [--load <snapshot>] [--save <snapshot>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    const char* experimentPath = argv[1];
+    const char* outputPath = argv[3];
+
+    //=== INITIALIZATIONS ===//
+    ParameterAssigner parameterAssigner(experimentPath);
+    Environment environment(&parameterAssigner);
+    environment.initializeEnvironment();
+
+    for (size_t i = 0; i < parameterAssigner.anthillParameters.size(); i++) environment.createNest(i);
+    for (size_t i = 0; i < parameterAssigner.foodParameters.size(); i++) environment.createFoodSource(i);
+    for (size_t i = 0; i < parameterAssigner.anthillParameters.size(); i++) environment.createAnt(i);
+
+    if (loadPath != NULL && !environment.loadSnapshot(loadPath)) return EXIT_FAILURE;
+    if (environment.numberOfAnts <= 0)
+    {
+        fprintf(stderr, "%s has no ants to simulate, give its nests positive antAmounts\n", loadPath != NULL ? loadPath : experimentPath);
+        return EXIT_FAILURE;
+    }
+
+    //=== EXECUTION LOOP ===//
+    // Same frame counter as the windowed loop, it wraps at 1000 and picks up
+    // where a snapshot left it
+    unsigned int frameCounter = environment.tick % 1000;
+    auto start = chrono::steady_clock::now();
+
+    for (long long t = 0; t < ticks; t++)
+    {
+        frameCounter = (frameCounter + 1) % 1000;
+        environment.run(frameCounter);
+    }
+
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    TRACE_WRITE("trace.json");
+
+    if (savePath != NULL && !environment.saveSnapshot(savePath)) return EXIT_FAILURE;
+
+    //=== OUTPUT ===//
+    FILE* output = fopen(outputPath, "w");
+    if (output == NULL)
+    {
+        fprintf(stderr, "could not open %s\n", outputPath);
+        return EXIT_FAILURE;
+    }
+
+    AntSwarm* ants = &environment.ants;
+    fprintf(output, "id,nestID,posX,posY,theta,state,carryingFood\n");
+    for (int i = 0; i < ants->numberOfAnts; i++)
+    {
+        Ant ant = ants->load(i);
+        fprintf(output, "%d,%d,%.9g,%.9g,%.9g,%d,%d\n", i, ants->speciesOf(i).nestID, ant.posX, ant.posY, ant.theta, ant.state, ant.carryingFood);
+    }
+    fclose(output);
+
+    printf("%lld ticks, %d ants (%zu bytes each), %d threads: %.3f s, %.1f ticks/s, %.2f ns/ant/tick\n",
+        ticks, environment.numberOfAnts, ants->bytesPerAnt(), environment.threadPool->numberOfThreads, seconds,
+        ticks / seconds, seconds * 1e9 / ((double)ticks * environment.numberOfAnts));
+
+    //=== EXIT ===//
+    return EXIT_SUCCESS;
+}
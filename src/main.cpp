@@ -9,10 +9,9 @@ int main()
     openglContext.init();
     OpenglBuffersManager openglBuffersManager;
 
-    srand(GLOBAL_SEED);
-
     //=== EXECUTION LOOP ===/
     openglContext.run(&openglBuffersManager);
+    TRACE_WRITE("trace.json");
 
     //=== EXIT ===/
     return EXIT_SUCCESS;
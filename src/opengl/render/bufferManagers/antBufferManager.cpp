@@ -18,6 +18,17 @@ void OpenglBuffersManager::createAntComponents()
     antsVAO->unbind();  
 }
 
+void OpenglBuffersManager::addAnts(AntSwarm* ants, int firstAnt)
+{
+    for (int i = firstAnt; i < ants->numberOfAnts; i++)
+    {
+        Ant ant = ants->load(i);
+        addElement(&antsTransformationMatrices, ants->speciesOf(i).size, ant.posX, ant.posY, ant.theta);
+    }
+
+    updateBuffer(antsTransformationMatricesVBO, ants->numberOfAnts, antsTransformationMatrices, GL_DYNAMIC_DRAW);
+}
+
 void OpenglBuffersManager::drawAnts(int numberOfAnts, Camera* camera)
 {
 
@@ -32,22 +43,28 @@ void OpenglBuffersManager::drawAnts(int numberOfAnts, Camera* camera)
     antsVAO->unbind();
 }
 
-void OpenglBuffersManager::updateModelAnts(int numberOfAnts, vector<Ant*> ants)
+void OpenglBuffersManager::updateModelAnts(AntSwarm* ants)
 {
-    glm::mat4 model;
-    Ant* currentAnt;
+    TRACE_SCOPE("OpenglBuffersManager::updateModelAnts");
 
-    for (int i = 0; i < numberOfAnts; i++)
+    for (int i = 0; i < ants->numberOfAnts; i++)
     {       
-        currentAnt = ants[i];
-
-        model = glm::mat4(1.0f);
+        Ant ant = ants->load(i);
+        float size = ants->speciesOf(i).size;
+        float angle = ant.theta - glm::radians(90.0f);
 
-        model = glm::scale(model, glm::vec3(currentAnt->size, currentAnt->size, 1.0));
-        model = glm::rotate(model, (currentAnt->theta-glm::radians(90.0f)), glm::vec3(0.0f, 0.0f, 1.0f));
-        model[3][0] = (float)currentAnt->posX;
-        model[3][1] = (float)currentAnt->posY;
+        float sine, cosine;
+        sinCosPolynomial(angle, sine, cosine);
 
-        antsTransformationMatrices[i] = model;
+        // scale(size, size, 1) then rotate about z, written out instead of two
+        // full matrix products per ant
+        glm::mat4& model = antsTransformationMatrices[i];
+        model = glm::mat4(1.0f);
+        model[0][0] = size * cosine;
+        model[0][1] = size * sine;
+        model[1][0] = -model[0][1];
+        model[1][1] = model[0][0];
+        model[3][0] = ant.posX;
+        model[3][1] = ant.posY;
     }
 }
@@ -19,6 +19,12 @@ void OpenglBuffersManager::createAnthillComponents()
     anthillsVAO->unbind();     
 }
 
+void OpenglBuffersManager::addAnthill(Anthill* anthill, int numberOfAnthills)
+{
+    addElement(&anthillsTransformationMatrices, anthill->size, anthill->posX, anthill->posY, 0.0f);
+    updateBuffer(anthillsTransformationMatricesVBO, numberOfAnthills, anthillsTransformationMatrices, GL_STATIC_DRAW);
+}
+
 void OpenglBuffersManager::drawAnthills(int numberOfAnthills, Camera* camera)
 {
     shaderAnts->bind();
@@ -19,6 +19,26 @@ void OpenglBuffersManager::createFoodComponents()
     foodsVAO->unbind();    
 }
 
+void OpenglBuffersManager::addFoodSource(FoodSource* food, int numberOfFoods)
+{
+    addElement(&foodsTransformationMatrices, food->drawnSize(), food->posX, food->posY, 0.0f);
+    updateBuffer(foodsTransformationMatricesVBO, numberOfFoods, foodsTransformationMatrices, GL_STATIC_DRAW);
+}
+
+// Emptied sources leave the environment during the tick and the others shrink
+// as their food is taken, the instances are rebuilt from the ones left
+void OpenglBuffersManager::updateFoodSources(vector<FoodSource*>& foods)
+{
+    foodsTransformationMatrices.clear();
+    for (FoodSource* food : foods)
+    {
+        __atomic_store_n(&food->changed, false, __ATOMIC_RELAXED);
+        addElement(&foodsTransformationMatrices, food->drawnSize(), food->posX, food->posY, 0.0f);
+    }
+    if (!foods.empty())
+        updateBuffer(foodsTransformationMatricesVBO, foods.size(), foodsTransformationMatrices, GL_STATIC_DRAW);
+}
+
 void OpenglBuffersManager::drawFoods(int numberOfFoods, Camera* camera)
 {
     //foodsTransformationMatricesVBO->resizeBuffer(sizeof(glm::mat4) * numberOfFoods, (glm::mat4*)&foodsTransformationMatrices[0], GL_STATIC_DRAW);
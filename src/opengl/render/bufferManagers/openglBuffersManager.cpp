@@ -2,9 +2,9 @@
 
 int    CHANNEL_COUNT    = 4;
 GLenum PIXEL_FORMAT     = GL_RGBA;
-int    DATA_SIZE        = PIXEL_WIDTH * PIXEL_HEIGHT * CHANNEL_COUNT; // Size of the pixel data content
-GLuint pboIds[2]; // IDs of PBO
-GLuint textureId; // ID of texture
+size_t DATA_SIZE        = 0; // Size of the pixel data content, set once the world size is known
+GLuint pboIds[2] = {0, 0}; // IDs of PBO
+GLuint textureId = 0; // ID of texture
 int indexPBO = 0;
 int nextIndexPBO = 0;
 
@@ -94,17 +94,49 @@ void OpenglBuffersManager::createPheromoneComponents()
     pheromoneVAO->unbind();
     indicesVerticesEBO.unbind();
 
+    // The texture and the pixel buffers wait for the world size of the experiment
+    textureWidth = 0;
+    textureHeight = 0;
+    texturePixelBuffers = false;
+}
+
+// Sizes the texture and the pixel buffers to a width x height world, they are
+// built again whenever an experiment brings another resolution or layout. The
+// tiled layout gets no pixel buffers and no host copy of the world.
+void OpenglBuffersManager::resizePheromoneBuffers(int width, int height, bool pixelBuffers)
+{
+    if(textureId != 0)
+        glDeleteTextures(1, &textureId);
+    if(pboIds[0] != 0)
+    {
+        glDeleteBuffers(2, pboIds);
+        pboIds[0] = pboIds[1] = 0;
+    }
+
+    GLint maxTextureSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    if(width > maxTextureSize || height > maxTextureSize)
+        cout << "ERROR::TEXTURE::WORLD_LARGER_THAN_MAX_TEXTURE_SIZE " << width << "x" << height << " > " << maxTextureSize << endl;
+
+    textureWidth = width;
+    textureHeight = height;
+    texturePixelBuffers = pixelBuffers;
+    DATA_SIZE = (size_t)width * height * CHANNEL_COUNT;
+
     createTextureBuffer();
-    createPixelBuffers();
+    if(pixelBuffers) createPixelBuffers();
 }
 
 //------------PHEROMONE----------------------
 void OpenglBuffersManager::createTextureBuffer()
 {
     GLubyte* imageData = 0;
-    // allocate texture buffer
-    imageData = new GLubyte[DATA_SIZE];
-    memset(imageData, 0, DATA_SIZE);
+    // allocate texture buffer, the tiled layout clears it on the GPU instead
+    if(texturePixelBuffers)
+    {
+        imageData = new GLubyte[DATA_SIZE];
+        memset(imageData, 0, DATA_SIZE);
+    }
 
     glGenTextures(1, &textureId);
     glBindTexture(GL_TEXTURE_2D, textureId);
@@ -112,8 +144,29 @@ void OpenglBuffersManager::createTextureBuffer()
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, PIXEL_WIDTH, PIXEL_HEIGHT, 0, PIXEL_FORMAT, GL_UNSIGNED_BYTE, (GLvoid*)imageData);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, textureWidth, textureHeight, 0, PIXEL_FORMAT, GL_UNSIGNED_BYTE, (GLvoid*)imageData);
     glBindTexture(GL_TEXTURE_2D, 0);
+
+    if(imageData != 0) delete[] imageData;
+    else clearTextureBuffer();
+}
+
+// Zeroes the texture through a framebuffer, glClearTexImage needs OpenGL 4.4
+void OpenglBuffersManager::clearTextureBuffer()
+{
+    GLfloat clearColor[4];
+    glGetFloatv(GL_COLOR_CLEAR_VALUE, clearColor);
+
+    GLuint framebufferId;
+    glGenFramebuffers(1, &framebufferId);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebufferId);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureId, 0);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glDeleteFramebuffers(1, &framebufferId);
 }
 
 void OpenglBuffersManager::createPixelBuffers()
@@ -127,8 +180,10 @@ void OpenglBuffersManager::createPixelBuffers()
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 }
 
-void OpenglBuffersManager::swapPixelBuffers(uint8_t* pheromoneMatrix)
+void OpenglBuffersManager::swapPixelBuffers(PheromoneMatrix* pheromoneMatrix)
 {
+    TRACE_SCOPE("OpenglBuffersManager::swapPixelBuffers");
+
     // In dual PBO mode, increment current index first then get the next index
     indexPBO = (indexPBO + 1) % 2;
     nextIndexPBO = (indexPBO + 1) % 2;
@@ -138,7 +193,14 @@ void OpenglBuffersManager::swapPixelBuffers(uint8_t* pheromoneMatrix)
     glBufferData(GL_PIXEL_UNPACK_BUFFER, DATA_SIZE, 0, GL_STREAM_DRAW);
     pixelMap = (GLbitfield*)glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY); 
 
-    memcpy(pixelMap, pheromoneMatrix, DATA_SIZE); // smaller BOTTLE NECK
+    // The driver may refuse to map a buffer as large as a huge world
+    if(pixelMap == NULL)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return;
+    }
+
+    pheromoneMatrix->exportRGBA((uint8_t*)pixelMap); // smaller BOTTLE NECK, interleaves the planar layout
     glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER); // release pointer to mapping buffer
 
     // bind Texture
@@ -146,16 +208,52 @@ void OpenglBuffersManager::swapPixelBuffers(uint8_t* pheromoneMatrix)
 
     // copy pixels from PBO to texture object
     // Use offset instead of pointer.
-    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, PIXEL_WIDTH, PIXEL_HEIGHT, PIXEL_FORMAT, GL_UNSIGNED_BYTE, 0); // Big BOTTLE NECK if the screen grows
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, textureWidth, textureHeight, PIXEL_FORMAT, GL_UNSIGNED_BYTE, 0); // Big BOTTLE NECK if the screen grows
 
     // It is good idea to release PBOs with ID 0 after use.
     // Once bound with 0, all pixel operations behave normal ways.
     glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
 }
 
-void OpenglBuffersManager::drawPheromone(uint8_t* pheromoneMatrix, Camera* camera)
+// Tiled layout: only the tiles holding pheromone and the ones freed since the
+// last frame are sent, straight from the tile memory
+void OpenglBuffersManager::uploadPheromoneTiles(PheromoneMatrix* pheromoneMatrix)
+{
+    TRACE_SCOPE("OpenglBuffersManager::uploadPheromoneTiles");
+
+    static const vector<uint32_t> emptyTile(PHEROMONE_TILE_SIZE * PHEROMONE_TILE_SIZE, 0xff000000u);
+
+    glBindTexture(GL_TEXTURE_2D, textureId);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, PHEROMONE_TILE_SIZE);
+
+    auto uploadTile = [&](int tile, const void* pixels)
+    {
+        int firstX = (tile % pheromoneMatrix->tilesX) << PHEROMONE_TILE_SHIFT;
+        int firstY = (tile / pheromoneMatrix->tilesX) << PHEROMONE_TILE_SHIFT;
+        int columns = min(PHEROMONE_TILE_SIZE, pheromoneMatrix->width - firstX);
+        int rows = min(PHEROMONE_TILE_SIZE, pheromoneMatrix->height - firstY);
+
+        glTexSubImage2D(GL_TEXTURE_2D, 0, firstX, firstY, columns, rows, PIXEL_FORMAT, GL_UNSIGNED_BYTE, pixels);
+    };
+
+    // Cleared first, a tile can be freed and allocated again in between
+    for(int tile : pheromoneMatrix->releasedTiles) uploadTile(tile, emptyTile.data());
+    pheromoneMatrix->releasedTiles.clear();
+
+    for(int tile : pheromoneMatrix->activeTiles) uploadTile(tile, pheromoneMatrix->tiles[tile]);
+
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void OpenglBuffersManager::drawPheromone(PheromoneMatrix* pheromoneMatrix, Camera* camera)
 {
-    swapPixelBuffers(pheromoneMatrix);
+    bool pixelBuffers = pheromoneMatrix->layout != TILED;
+    if(pheromoneMatrix->width != textureWidth || pheromoneMatrix->height != textureHeight || pixelBuffers != texturePixelBuffers)
+        resizePheromoneBuffers(pheromoneMatrix->width, pheromoneMatrix->height, pixelBuffers);
+
+    if(pheromoneMatrix->layout == TILED) uploadPheromoneTiles(pheromoneMatrix);
+    else swapPixelBuffers(pheromoneMatrix);
 
     shaderPheromone->bind();
     shaderPheromone->setMat4("view", camera->GetViewMatrix());
@@ -168,3 +266,22 @@ void OpenglBuffersManager::drawPheromone(uint8_t* pheromoneMatrix, Camera* camer
     pheromoneVAO->unbind();
    
 }
+
+
+void OpenglBuffersManager::drawEnvironment(Environment* environment, Camera* camera)
+{
+    TRACE_SCOPE("OpenglBuffersManager::drawEnvironment");
+
+    updateModelAnts(&environment->ants);
+    drawAnts(environment->numberOfAnts, camera);
+    drawAnthills(environment->numberOfNests, camera);
+    bool foodsChanged = foodsTransformationMatrices.size() != environment->foods.size();
+    for (FoodSource* food : environment->foods)
+        foodsChanged = foodsChanged || __atomic_load_n(&food->changed, __ATOMIC_RELAXED);
+    if (foodsChanged)
+        updateFoodSources(environment->foods);
+    drawFoods(environment->numberOfFoods, camera);
+    // Lazy evaporation only catches up here, for the blocks that still hold pheromone
+    environment->pheromoneMatrix->settle(environment->threadPool);
+    drawPheromone(environment->pheromoneMatrix, camera);
+}
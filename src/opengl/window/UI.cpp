@@ -28,6 +28,20 @@ void UI::init(GLFWwindow* window)
 
     nestID = 0;
 
+    snprintf(snapshotPath, sizeof(snapshotPath), "src/swarmEnvironment/experiments/experiment.snapshot");
+
+    snprintf(trajectoryPath, sizeof(trajectoryPath), "src/swarmEnvironment/experiments/experiment.trajectory");
+    snprintf(pheromonePath, sizeof(pheromonePath), "src/swarmEnvironment/experiments/experiment.pheromone");
+    replayPlaying = false;
+    replaySpeed = 600.0f;
+    replayTick = 0;
+    replayFirstTick = 0;
+    replayLastTick = 0;
+    replaySeek = false;
+
+    evolutionParameters = EvolutionParameters();
+    evolutionRunning = false;
+
     halfScreenSize = PIXEL_WIDTH/2;
 
     ImGui::CreateContext();
@@ -39,6 +53,13 @@ void UI::init(GLFWwindow* window)
     ImGui_ImplOpenGL3_Init("#version 330");
 }
 
+// The evolution section of the experiment, the same search swarm_evolve runs.
+// An evolution already running keeps the parameters it started with.
+void UI::loadExperiment(ParameterAssigner* parameterAssigner)
+{
+    if(!evolutionRunning) evolutionParameters = parameterAssigner->evolutionParameters;
+}
+
 void UI::pre_render()
 {  
     ImGui_ImplOpenGL3_NewFrame();   
@@ -101,6 +122,11 @@ void UI::render()
                 antsRealTimeInteractionsTab();
                 ImGui::EndTabItem();
             }
+            if (ImGui::BeginTabItem("Replay"))
+            {
+                replayTab();
+                ImGui::EndTabItem();
+            }
             ImGui::EndTabBar();
         }
         ImGui::End(); 
@@ -109,6 +135,7 @@ void UI::render()
         ImGui::End();
 
         ImGui::Begin("Evolutionary Algorithm", NULL, NULL);
+        evolutionaryAlgorithmWindow();
         ImGui::End();
 
     ImGui::End();
@@ -125,6 +152,8 @@ void UI::post_render()
 
 void UI::run()
 {
+    TRACE_SCOPE("UI::run");
+
     pre_render();
     render(); 
     post_render();
@@ -184,8 +213,10 @@ void UI::experimentsTab()
             {
                 if(ImGui::Button("Open experiment")) stateSimulation = RUNNING;
                 ImGui::SameLine();
-                if(ImGui::Button("Save experiment")) stateSimulation = RUNNING;
-                if(ImGui::Button("Load experiment")) stateSimulation = RUNNING;
+                ImGui::InputText("Snapshot", snapshotPath, sizeof(snapshotPath));
+                if(ImGui::Button("Save experiment")) UIAction = SAVE_SNAPSHOT;
+                ImGui::SameLine();
+                if(ImGui::Button("Load experiment")) UIAction = LOAD_SNAPSHOT;
 
                 ImGui::EndTabItem();
             }
@@ -255,3 +286,61 @@ void UI::antsRealTimeInteractionsTab()
         ImGui::EndTabBar();
     }
 }
+
+void UI::replayTab()
+{
+    ImGui::InputText("Trajectory", trajectoryPath, sizeof(trajectoryPath));
+    ImGui::InputText("Pheromone", pheromonePath, sizeof(pheromonePath));
+    if(ImGui::Button("Open replay"))
+    {
+        stateSimulation = REPLAY;
+        UIAction = OPEN_REPLAY;
+    }
+
+    if(stateSimulation != REPLAY) return;
+
+    ImGui::SameLine(); ImGui::Checkbox("Play", &replayPlaying);
+    ImGui::Text("Ticks per second: "); ImGui::SameLine(); ImGui::InputFloat("##replaySpeed", &replaySpeed, 100.0f, 1000.0f, "%.0f");
+    if(ImGui::SliderScalar("Tick", ImGuiDataType_U64, &replayTick, &replayFirstTick, &replayLastTick)) replaySeek = true;
+}
+
+void UI::evolutionaryAlgorithmWindow()
+{
+    const int intSteps1 = 1;
+    const char* selections[] = {"Tournament", "Roulette"};
+    const char* crossovers[] = {"Uniform", "One point", "Blend"};
+    const char* mutations[] = {"Gaussian", "Uniform"};
+
+    // Read when the evolution starts, left alone while it runs
+    ImGui::BeginDisabled(evolutionRunning);
+    ImGui::InputInt("Ant species", &evolutionParameters.antEspecification);
+    ImGui::InputInt("Population", &evolutionParameters.populationSize);
+    ImGui::InputInt("Generations", &evolutionParameters.generations);
+    ImGui::InputInt("Ticks per evaluation", &evolutionParameters.evaluationTicks, 100, 1000);
+    ImGui::InputInt("Elitism", &evolutionParameters.elitism);
+    ImGui::Combo("Selection", (int*)&evolutionParameters.selection, selections, IM_ARRAYSIZE(selections));
+    if(evolutionParameters.selection == TOURNAMENT_SELECTION) ImGui::InputInt("Tournament size", &evolutionParameters.tournamentSize);
+    ImGui::Combo("Crossover", (int*)&evolutionParameters.crossover, crossovers, IM_ARRAYSIZE(crossovers));
+    ImGui::SliderFloat("Crossover rate", &evolutionParameters.crossoverRate, 0.0f, 1.0f);
+    ImGui::Combo("Mutation", (int*)&evolutionParameters.mutation, mutations, IM_ARRAYSIZE(mutations));
+    ImGui::SliderFloat("Mutation rate", &evolutionParameters.mutationRate, 0.0f, 1.0f);
+    if(evolutionParameters.mutation == GAUSSIAN_MUTATION) ImGui::SliderFloat("Mutation scale", &evolutionParameters.mutationScale, 0.0f, 1.0f);
+    ImGui::InputInt("Threads (0 = all)", &evolutionParameters.numberOfThreads);
+    ImGui::InputScalar("Seed", ImGuiDataType_U32, &evolutionParameters.seed, &intSteps1, NULL, "%u");
+    ImGui::EndDisabled();
+
+    if(!evolutionRunning && ImGui::Button("Evolve")) UIAction = START_EVOLUTION;
+    else if(evolutionRunning && ImGui::Button("Stop")) UIAction = STOP_EVOLUTION;
+    ImGui::SameLine();
+    ImGui::BeginDisabled(evolutionBest.empty());
+    if(ImGui::Button("Apply best")) UIAction = APPLY_EVOLUTION;
+    ImGui::EndDisabled();
+
+    ImGui::Text("Generation %d of %d", (int)evolutionBestFitness.size(), evolutionParameters.generations);
+    if(evolutionBestFitness.empty()) return;
+
+    ImGui::PlotLines("Best food", evolutionBestFitness.data(), evolutionBestFitness.size(), 0, NULL, 0.0f, FLT_MAX, ImVec2(0, 80));
+    ImGui::PlotLines("Mean food", evolutionMeanFitness.data(), evolutionMeanFitness.size(), 0, NULL, 0.0f, FLT_MAX, ImVec2(0, 80));
+    ImGui::Text("Best of generation %d, %.0f food:", (int)evolutionBestFitness.size() - 1, evolutionBestFitness.back());
+    ImGui::TextUnformatted(evolutionBest.c_str());
+}
@@ -40,6 +40,7 @@ static void mouseButtonCallback(GLFWwindow* window, int button, int action,
 
 // Destructor
 OpenglContext::~OpenglContext() {
+  delete evolution;
   glfwDestroyWindow(swarmSimulatorWindow);
   glfwTerminate();
 }
@@ -107,6 +108,7 @@ void OpenglContext::init() {
   userInterface->init(swarmSimulatorWindow);
 
   openGlRenderUpdateFrameRate = 1;
+  evolution = NULL;
 
   AdditionalParameters =
       (AdditionalCallbackParameters*)malloc(sizeof(AdditionalParameters));
@@ -147,6 +149,172 @@ void OpenglContext::post_render() {
 }
 
 
+/**
+ * @brief Saves or restores the environment when the UI asks for it, a restored
+ * environment is mirrored into the buffers again.
+ * @param openglBuffersManager Pointer to the OpenGL buffers manager.
+ */
+void OpenglContext::snapshotActions(OpenglBuffersManager* openglBuffersManager) {
+  switch (userInterface->UIAction) {
+    case SAVE_SNAPSHOT: {
+      environment->saveSnapshot(userInterface->snapshotPath);
+      userInterface->UIAction = DO_NOTHING;
+    } break;  // case SAVE_SNAPSHOT
+
+    case LOAD_SNAPSHOT: {
+      if (environment->loadSnapshot(userInterface->snapshotPath))
+        mirrorEnvironment(openglBuffersManager, environment);
+      userInterface->UIAction = DO_NOTHING;
+    } break;  // case LOAD_SNAPSHOT
+
+    default:
+      break;
+  }
+}
+
+
+/**
+ * @brief Starts, stops or applies the evolution when the UI asks for it and
+ * reports its progress to the UI. The evolution runs on threads of its own, the
+ * render loop never waits for a generation.
+ */
+void OpenglContext::evolutionActions() {
+  switch (userInterface->UIAction) {
+    case START_EVOLUTION: {
+      delete evolution;
+      evolution = new EvolutionaryAlgorithm(parameterAssigner,
+                                            userInterface->evolutionParameters);
+      evolution->start();
+      userInterface->UIAction = DO_NOTHING;
+    } break;  // case START_EVOLUTION
+
+    case STOP_EVOLUTION: {
+      if (evolution != NULL) evolution->stop();
+      userInterface->UIAction = DO_NOTHING;
+    } break;  // case STOP_EVOLUTION
+
+    case APPLY_EVOLUTION: {
+      // Ants added from now on and the ants already there both take the best
+      // individual of the last generation
+      vector<GenerationResult> results;
+      if (evolution != NULL) results = evolution->results();
+      if (!results.empty()) {
+        evolution->decode(
+            results.back().best,
+            parameterAssigner
+                ->antParameters[evolution->parameters.antEspecification]);
+        environment->ants.updateSpecies();
+      }
+      userInterface->UIAction = DO_NOTHING;
+    } break;  // case APPLY_EVOLUTION
+
+    default:
+      break;
+  }
+
+  if (evolution == NULL) return;
+
+  vector<GenerationResult> results = evolution->results();
+  userInterface->evolutionRunning = evolution->isRunning();
+  if (results.size() != userInterface->evolutionBestFitness.size()) {
+    userInterface->evolutionBestFitness.clear();
+    userInterface->evolutionMeanFitness.clear();
+    for (GenerationResult& result : results) {
+      userInterface->evolutionBestFitness.push_back(result.bestFitness);
+      userInterface->evolutionMeanFitness.push_back(result.meanFitness);
+    }
+    userInterface->evolutionBest =
+        results.empty()
+            ? ""
+            : EvolutionaryAlgorithm::describe(results.back().best);
+  }
+}
+
+
+/**
+ * @brief Rebuilds the nest, food and ant buffers from an environment.
+ * @param openglBuffersManager Pointer to the OpenGL buffers manager.
+ * @param mirrored Environment the buffers follow from now on.
+ */
+void OpenglContext::mirrorEnvironment(OpenglBuffersManager* openglBuffersManager,
+                                      Environment* mirrored) {
+  openglBuffersManager->resetBufferManager();
+  for (int i = 0; i < mirrored->numberOfNests; i++)
+    openglBuffersManager->addAnthill(mirrored->nests[i], i + 1);
+  openglBuffersManager->updateFoodSources(mirrored->foods);
+  openglBuffersManager->addAnts(&mirrored->ants, 0);
+}
+
+
+/**
+ * @brief Plays a recorded trajectory back without simulating it. The frames
+ * go into an environment of their own with the nests and food sources of the
+ * experiment, the environment being simulated is left as it was.
+ * @param openglBuffersManager Pointer to the OpenGL buffers manager.
+ */
+void OpenglContext::replay(OpenglBuffersManager* openglBuffersManager) {
+  // The recorders of the experiment would truncate the files being played
+  ParameterAssigner replayExperiment = *parameterAssigner;
+  replayExperiment.environmentParameters.trajectoryPath = "";
+  replayExperiment.environmentParameters.pheromonePath = "";
+
+  Environment replayEnvironment(&replayExperiment);
+  replayEnvironment.initializeEnvironment();
+  for (size_t i = 0; i < parameterAssigner->anthillParameters.size(); i++)
+    replayEnvironment.createNest(i);
+  for (size_t i = 0; i < parameterAssigner->foodParameters.size(); i++)
+    replayEnvironment.createFoodSource(i);
+  mirrorEnvironment(openglBuffersManager, &replayEnvironment);
+
+  TrajectoryPlayer player;
+  double lastTime = glfwGetTime();
+
+  while (userInterface->stateSimulation == REPLAY &&
+         !glfwWindowShouldClose(swarmSimulatorWindow)) {
+    TRACE_SCOPE("frame");
+    pollEvents();
+
+    if (userInterface->UIAction == OPEN_REPLAY) {
+      if (player.open(userInterface->trajectoryPath,
+                      userInterface->pheromonePath)) {
+        userInterface->replayFirstTick = player.firstTick;
+        userInterface->replayLastTick = player.lastTick;
+      }
+      userInterface->UIAction = DO_NOTHING;
+    }
+    if (userInterface->replaySeek) {
+      player.seek(userInterface->replayTick);
+      userInterface->replaySeek = false;
+    }
+
+    // Playback follows the clock, not the frame rate
+    double now = glfwGetTime();
+    player.playing = userInterface->replayPlaying;
+    player.speed = userInterface->replaySpeed;
+    player.advance(now - lastTime);
+    lastTime = now;
+    userInterface->replayPlaying = player.playing;
+    userInterface->replayTick = (uint64_t)player.position;
+
+    // The transformation matrices only grow, a smaller frame draws fewer
+    if (player.showFrame(&replayEnvironment) &&
+        replayEnvironment.numberOfAnts >
+            (int)openglBuffersManager->antsTransformationMatrices.size())
+      openglBuffersManager->addAnts(
+          &replayEnvironment.ants,
+          openglBuffersManager->antsTransformationMatrices.size());
+
+    pre_render();
+    openglBuffersManager->drawEnvironment(&replayEnvironment, camera);
+    userInterface->run();
+    post_render();
+  }
+
+  // The buffers go back to the environment being simulated
+  mirrorEnvironment(openglBuffersManager, environment);
+}
+
+
 /**
  * @brief Runs the rendering loop and manages different simulation states.
  * @param openglBuffersManager Pointer to the OpenGL buffers manager.
@@ -171,29 +339,37 @@ void OpenglContext::run(OpenglBuffersManager* openglBuffersManager) {
             case ENVIRONMENT_INIT: {
               parameterAssigner =
                   new ParameterAssigner("experiments/experiment.json");
+              userInterface->loadExperiment(parameterAssigner);
               environment = new Environment(parameterAssigner);
-              environment->initializeEnvironment(openglBuffersManager);
-              environment->draw(openglBuffersManager, camera);
+              environment->initializeEnvironment();
+              openglBuffersManager->drawEnvironment(environment, camera);
             } break;  //
             case ADD_NEST: {
-              environment->createNest(0, openglBuffersManager);
+              environment->createNest(0);
+              openglBuffersManager->addAnthill(environment->nests.back(),
+                                               environment->numberOfNests);
               userInterface->UIAction = DO_NOTHING;
             } break;  // case ADD_NEST
 
             case ADD_FOOD: {
-              environment->createFoodSource(0, openglBuffersManager);
+              environment->createFoodSource(0);
+              openglBuffersManager->addFoodSource(environment->foods.back(),
+                                                  environment->numberOfFoods);
               userInterface->UIAction = DO_NOTHING;
             } break;  // case ADD_FOOD
 
             case ADD_ANT: {
-              environment->createAnt(userInterface->nestID,
-                                     openglBuffersManager);
+              int firstAnt = environment->numberOfAnts;
+              environment->createAnt(userInterface->nestID);
+              openglBuffersManager->addAnts(&environment->ants, firstAnt);
               userInterface->UIAction = DO_NOTHING;
             } break;  // case ADD_ANT
           }           // swtich
 
           userInterface->run();
-          environment->draw(openglBuffersManager, camera);
+          snapshotActions(openglBuffersManager);
+          evolutionActions();
+          openglBuffersManager->drawEnvironment(environment, camera);
           post_render();
         }       // while loop
       } break;  // case RESET
@@ -201,6 +377,8 @@ void OpenglContext::run(OpenglBuffersManager* openglBuffersManager) {
       case RUNNING: {
         // Run simulation loop while in RUNNING state
         while (userInterface->stateSimulation == RUNNING) {
+          // Parent of every event of one frame, a slow frame stands out here
+          TRACE_SCOPE("frame");
           pollEvents();  // Framecounter++ here
 
         
@@ -211,10 +389,12 @@ void OpenglContext::run(OpenglBuffersManager* openglBuffersManager) {
             openGlRenderUpdateFrameRate =
                 userInterface->openGlRenderUpdateFrameRate;
             pre_render();
-            environment->draw(openglBuffersManager, camera);
+            openglBuffersManager->drawEnvironment(environment, camera);
           }                      // if statement
           userInterface->run();  // RETIRAR DAQUI PARA MAIOR EXCLUSIVIDADE DO
                                  // RUN
+          snapshotActions(openglBuffersManager);
+          evolutionActions();
           post_render();
         }  // while loop
 
@@ -223,26 +403,35 @@ void OpenglContext::run(OpenglBuffersManager* openglBuffersManager) {
       case PAUSED: {
         parameterAssigner = new ParameterAssigner(
             "src/swarmEnvironment/experiments/experiment.json");
+        userInterface->loadExperiment(parameterAssigner);
         environment = new Environment(parameterAssigner);
-        environment->initializeEnvironment(openglBuffersManager);
-
-        environment->createNest(0, openglBuffersManager);
-        environment->createFoodSource(0, openglBuffersManager);
-        environment->createFoodSource(1, openglBuffersManager);
-        environment->createFoodSource(2, openglBuffersManager);
-        environment->createFoodSource(3, openglBuffersManager);
-        environment->createAnt(0, openglBuffersManager);
+        environment->initializeEnvironment();
+
+        environment->createNest(0);
+        openglBuffersManager->addAnthill(environment->nests[0], 1);
+        for (int i = 0; i < 4; i++) {
+          environment->createFoodSource(i);
+          openglBuffersManager->addFoodSource(environment->foods[i], i + 1);
+        }
+        environment->createAnt(0);
+        openglBuffersManager->addAnts(&environment->ants, 0);
         while (userInterface->stateSimulation == PAUSED) {
           pollEvents();
 
           pre_render();
-          environment->draw(openglBuffersManager, camera);
+          openglBuffersManager->drawEnvironment(environment, camera);
 
           userInterface->run();
+          snapshotActions(openglBuffersManager);
+          evolutionActions();
           post_render();
         }  // while loop
 
       } break;  // case PAUSED
+
+      case REPLAY: {
+        replay(openglBuffersManager);
+      } break;  // case REPLAY
     }           // switch statement
   }             // while loop
 }  // function scope
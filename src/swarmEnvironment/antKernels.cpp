@@ -0,0 +1,597 @@
+#include <antKernels.h>
+#include <immintrin.h>
+#include <climits>
+
+// Compiled per instruction set and picked at runtime like the pheromone kernels.
+// The build never contracts a*b + c (-ffp-contract=off), so neither the scalar
+// code nor the vector levels fuse a product, whatever instruction set they get.
+#define MULTIPLY_ADD128(a, b, c) _mm_add_ps(_mm_mul_ps(a, b), c)
+#define MULTIPLY_ADD256(a, b, c) _mm256_add_ps(_mm256_mul_ps(a, b), c)
+#define MULTIPLY_ADD512(a, b, c) _mm512_add_ps(_mm512_mul_ps(a, b), c)
+
+#define BORDER 0.990f
+
+static inline float clampToBorder(float position)
+{
+	if(position < -BORDER || position > BORDER) position = position < 0 ? -BORDER : BORDER;
+	return position;
+}
+
+// Gathers take 32 bit indices
+static inline bool gatherable(size_t elements)
+{
+	return elements <= (size_t)INT_MAX;
+}
+
+//=== SCALAR ===//
+
+static void sinCosScalar(const float* radians, float* sine, float* cosine, int count, TrigMode trigMode)
+{
+	for(int i = 0; i < count; i++) sinCos(radians[i], trigMode, sine[i], cosine[i]);
+}
+
+static void moveScalar(float* posX, float* posY, const float* theta, float velocity, int count, TrigMode trigMode)
+{
+	for(int i = 0; i < count; i++)
+	{
+		float sine, cosine;
+		sinCos(theta[i], trigMode, sine, cosine);
+		posX[i] = clampToBorder(posX[i] + velocity*cosine);
+		posY[i] = clampToBorder(posY[i] + velocity*sine);
+	}
+}
+
+static void placeSensorsScalar(const float* posX, const float* posY, const float* theta, float xDistance, float yDistance, float positionAngle,
+	float halfWidth, float halfHeight, int* cellX, int* cellY, int count, TrigMode trigMode)
+{
+	for(int i = 0; i < count; i++)
+	{
+		float sine, cosine;
+		sinCos(theta[i] + positionAngle, trigMode, sine, cosine);
+		float sensorX = posX[i] + xDistance*cosine;
+		float sensorY = posY[i] + yDistance*sine;
+		cellX[i] = halfWidth + sensorX*halfWidth;
+		cellY[i] = halfHeight + sensorY*halfHeight;
+	}
+}
+
+static void summedAreaBoxSumsScalar(uint32_t* const* tables, int width, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count)
+{
+	size_t tableWidth = (size_t)width + 1;
+	for(int i = 0; i < count; i++)
+	{
+		size_t top = (size_t)(cellY[i] - radius) * tableWidth;
+		size_t bottom = (size_t)(cellY[i] + radius + 1) * tableWidth;
+		int left = cellX[i] - radius;
+		int right = cellX[i] + radius + 1;
+
+		int sums[PHEROMONE_CHANNELS];
+		for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+			sums[c] = (int)(tables[c][bottom + right] - tables[c][top + right] - tables[c][bottom + left] + tables[c][top + left]);
+		readings[i] = {sums[RED], sums[GREEN], sums[BLUE]};
+	}
+}
+
+static void interleavedBoxSumsScalar(const uint8_t* rgba, int width, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count)
+{
+	for(int k = 0; k < count; k++)
+	{
+		PheromoneReading reading = {0, 0, 0};
+		for(int i = -radius; i <= radius; i++)
+		{
+			const uint8_t* row = rgba + ((size_t)(cellY[k] + i) * width + cellX[k]) * 4;
+			for(int j = -radius; j <= radius; j++)
+			{
+				reading.red += row[j * 4 + RED];
+				reading.green += row[j * 4 + GREEN];
+				reading.blue += row[j * 4 + BLUE];
+			}
+		}
+		readings[k] = reading;
+	}
+}
+
+//=== SSE2, 4 ants ===//
+
+__attribute__((target("sse2")))
+static inline void sinCosSSE2(__m128 radians, TrigMode trigMode, __m128& sine, __m128& cosine)
+{
+	if(trigMode == POLYNOMIAL_TRIG)
+	{
+		__m128i q = _mm_cvtps_epi32(_mm_mul_ps(radians, _mm_set1_ps(TRIG_TWO_OVER_PI)));
+		__m128 quadrant = _mm_xor_ps(_mm_cvtepi32_ps(q), _mm_set1_ps(-0.0f));
+		__m128 x = MULTIPLY_ADD128(quadrant, _mm_set1_ps(TRIG_HALF_PI_1), radians);
+		x = MULTIPLY_ADD128(quadrant, _mm_set1_ps(TRIG_HALF_PI_2), x);
+		x = MULTIPLY_ADD128(quadrant, _mm_set1_ps(TRIG_HALF_PI_3), x);
+		__m128 x2 = _mm_mul_ps(x, x);
+
+		__m128 s = MULTIPLY_ADD128(_mm_set1_ps(TRIG_SIN_3), x2, _mm_set1_ps(TRIG_SIN_2));
+		s = MULTIPLY_ADD128(s, x2, _mm_set1_ps(TRIG_SIN_1));
+		s = MULTIPLY_ADD128(s, _mm_mul_ps(x2, x), x);
+		__m128 c = MULTIPLY_ADD128(_mm_set1_ps(TRIG_COS_3), x2, _mm_set1_ps(TRIG_COS_2));
+		c = MULTIPLY_ADD128(c, x2, _mm_set1_ps(TRIG_COS_1));
+		c = MULTIPLY_ADD128(c, _mm_mul_ps(x2, x2), MULTIPLY_ADD128(_mm_set1_ps(-0.5f), x2, _mm_set1_ps(1.0f)));
+
+		// No blendv before SSE4.1
+		__m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(q, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+		__m128 sineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(q, _mm_set1_epi32(2)), 30));
+		__m128 cosineSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(q, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30));
+		sine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)), sineSign);
+		cosine = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)), cosineSign);
+		return;
+	}
+
+	__m128i index = _mm_cvttps_epi32(_mm_mul_ps(radians, _mm_set1_ps(TRIG_STEPS_PER_RADIAN)));
+	__m128i turn = _mm_set1_epi32(TRIG_TABLE_STEPS);
+	index = _mm_add_epi32(index, _mm_and_si128(_mm_cmplt_epi32(index, _mm_setzero_si128()), turn));
+	index = _mm_sub_epi32(index, _mm_and_si128(_mm_cmpgt_epi32(index, _mm_set1_epi32(TRIG_TABLE_STEPS - 1)), turn));
+
+	// No gathers before AVX2
+	alignas(16) int steps[4];
+	_mm_store_si128((__m128i*)steps, index);
+	cosine = _mm_setr_ps(trigTables.cosine[steps[0]], trigTables.cosine[steps[1]], trigTables.cosine[steps[2]], trigTables.cosine[steps[3]]);
+	sine = _mm_setr_ps(trigTables.sine[steps[0]], trigTables.sine[steps[1]], trigTables.sine[steps[2]], trigTables.sine[steps[3]]);
+}
+
+__attribute__((target("sse2")))
+static void sinCosSSE2(const float* radians, float* sine, float* cosine, int count, TrigMode trigMode)
+{
+	int i = 0;
+	for(; i + 4 <= count; i += 4)
+	{
+		__m128 s, c;
+		sinCosSSE2(_mm_loadu_ps(radians + i), trigMode, s, c);
+		_mm_storeu_ps(sine + i, s);
+		_mm_storeu_ps(cosine + i, c);
+	}
+	sinCosScalar(radians + i, sine + i, cosine + i, count - i, trigMode);
+}
+
+__attribute__((target("sse2")))
+static void moveSSE2(float* posX, float* posY, const float* theta, float velocity, int count, TrigMode trigMode)
+{
+	__m128 speed = _mm_set1_ps(velocity);
+	__m128 low = _mm_set1_ps(-BORDER), high = _mm_set1_ps(BORDER);
+	int i = 0;
+
+	for(; i + 4 <= count; i += 4)
+	{
+		__m128 sine, cosine;
+		sinCosSSE2(_mm_loadu_ps(theta + i), trigMode, sine, cosine);
+
+		__m128 x = MULTIPLY_ADD128(speed, cosine, _mm_loadu_ps(posX + i));
+		__m128 y = MULTIPLY_ADD128(speed, sine, _mm_loadu_ps(posY + i));
+		_mm_storeu_ps(posX + i, _mm_min_ps(_mm_max_ps(x, low), high));
+		_mm_storeu_ps(posY + i, _mm_min_ps(_mm_max_ps(y, low), high));
+	}
+
+	moveScalar(posX + i, posY + i, theta + i, velocity, count - i, trigMode);
+}
+
+__attribute__((target("sse2")))
+static void placeSensorsSSE2(const float* posX, const float* posY, const float* theta, float xDistance, float yDistance, float positionAngle,
+	float halfWidth, float halfHeight, int* cellX, int* cellY, int count, TrigMode trigMode)
+{
+	__m128 offset = _mm_set1_ps(positionAngle);
+	__m128 distanceX = _mm_set1_ps(xDistance), distanceY = _mm_set1_ps(yDistance);
+	__m128 scaleX = _mm_set1_ps(halfWidth), scaleY = _mm_set1_ps(halfHeight);
+	int i = 0;
+
+	for(; i + 4 <= count; i += 4)
+	{
+		__m128 sine, cosine;
+		sinCosSSE2(_mm_add_ps(_mm_loadu_ps(theta + i), offset), trigMode, sine, cosine);
+
+		__m128 sensorX = MULTIPLY_ADD128(distanceX, cosine, _mm_loadu_ps(posX + i));
+		__m128 sensorY = MULTIPLY_ADD128(distanceY, sine, _mm_loadu_ps(posY + i));
+		_mm_storeu_si128((__m128i*)(cellX + i), _mm_cvttps_epi32(MULTIPLY_ADD128(sensorX, scaleX, scaleX)));
+		_mm_storeu_si128((__m128i*)(cellY + i), _mm_cvttps_epi32(MULTIPLY_ADD128(sensorY, scaleY, scaleY)));
+	}
+
+	placeSensorsScalar(posX + i, posY + i, theta + i, xDistance, yDistance, positionAngle, halfWidth, halfHeight, cellX + i, cellY + i, count - i, trigMode);
+}
+
+//=== AVX2, 8 ants ===//
+
+__attribute__((target("avx2")))
+static inline void sinCosAVX2(__m256 radians, TrigMode trigMode, __m256& sine, __m256& cosine)
+{
+	if(trigMode == POLYNOMIAL_TRIG)
+	{
+		__m256i q = _mm256_cvtps_epi32(_mm256_mul_ps(radians, _mm256_set1_ps(TRIG_TWO_OVER_PI)));
+		__m256 quadrant = _mm256_xor_ps(_mm256_cvtepi32_ps(q), _mm256_set1_ps(-0.0f));
+		__m256 x = MULTIPLY_ADD256(quadrant, _mm256_set1_ps(TRIG_HALF_PI_1), radians);
+		x = MULTIPLY_ADD256(quadrant, _mm256_set1_ps(TRIG_HALF_PI_2), x);
+		x = MULTIPLY_ADD256(quadrant, _mm256_set1_ps(TRIG_HALF_PI_3), x);
+		__m256 x2 = _mm256_mul_ps(x, x);
+
+		__m256 s = MULTIPLY_ADD256(_mm256_set1_ps(TRIG_SIN_3), x2, _mm256_set1_ps(TRIG_SIN_2));
+		s = MULTIPLY_ADD256(s, x2, _mm256_set1_ps(TRIG_SIN_1));
+		s = MULTIPLY_ADD256(s, _mm256_mul_ps(x2, x), x);
+		__m256 c = MULTIPLY_ADD256(_mm256_set1_ps(TRIG_COS_3), x2, _mm256_set1_ps(TRIG_COS_2));
+		c = MULTIPLY_ADD256(c, x2, _mm256_set1_ps(TRIG_COS_1));
+		c = MULTIPLY_ADD256(c, _mm256_mul_ps(x2, x2), MULTIPLY_ADD256(_mm256_set1_ps(-0.5f), x2, _mm256_set1_ps(1.0f)));
+
+		__m256 swap = _mm256_castsi256_ps(_mm256_slli_epi32(q, 31));
+		__m256 sineSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(q, _mm256_set1_epi32(2)), 30));
+		__m256 cosineSign = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(q, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30));
+		sine = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), sineSign);
+		cosine = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), cosineSign);
+		return;
+	}
+
+	__m256i index = _mm256_cvttps_epi32(_mm256_mul_ps(radians, _mm256_set1_ps(TRIG_STEPS_PER_RADIAN)));
+	__m256i turn = _mm256_set1_epi32(TRIG_TABLE_STEPS);
+	index = _mm256_add_epi32(index, _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_setzero_si256(), index), turn));
+	index = _mm256_sub_epi32(index, _mm256_and_si256(_mm256_cmpgt_epi32(index, _mm256_set1_epi32(TRIG_TABLE_STEPS - 1)), turn));
+	cosine = _mm256_i32gather_ps(trigTables.cosine, index, 4);
+	sine = _mm256_i32gather_ps(trigTables.sine, index, 4);
+}
+
+__attribute__((target("avx2")))
+static void sinCosAVX2(const float* radians, float* sine, float* cosine, int count, TrigMode trigMode)
+{
+	int i = 0;
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256 s, c;
+		sinCosAVX2(_mm256_loadu_ps(radians + i), trigMode, s, c);
+		_mm256_storeu_ps(sine + i, s);
+		_mm256_storeu_ps(cosine + i, c);
+	}
+	sinCosScalar(radians + i, sine + i, cosine + i, count - i, trigMode);
+}
+
+__attribute__((target("avx2")))
+static void moveAVX2(float* posX, float* posY, const float* theta, float velocity, int count, TrigMode trigMode)
+{
+	__m256 speed = _mm256_set1_ps(velocity);
+	__m256 low = _mm256_set1_ps(-BORDER), high = _mm256_set1_ps(BORDER);
+	int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256 sine, cosine;
+		sinCosAVX2(_mm256_loadu_ps(theta + i), trigMode, sine, cosine);
+
+		__m256 x = MULTIPLY_ADD256(speed, cosine, _mm256_loadu_ps(posX + i));
+		__m256 y = MULTIPLY_ADD256(speed, sine, _mm256_loadu_ps(posY + i));
+		_mm256_storeu_ps(posX + i, _mm256_min_ps(_mm256_max_ps(x, low), high));
+		_mm256_storeu_ps(posY + i, _mm256_min_ps(_mm256_max_ps(y, low), high));
+	}
+
+	moveScalar(posX + i, posY + i, theta + i, velocity, count - i, trigMode);
+}
+
+__attribute__((target("avx2")))
+static void placeSensorsAVX2(const float* posX, const float* posY, const float* theta, float xDistance, float yDistance, float positionAngle,
+	float halfWidth, float halfHeight, int* cellX, int* cellY, int count, TrigMode trigMode)
+{
+	__m256 offset = _mm256_set1_ps(positionAngle);
+	__m256 distanceX = _mm256_set1_ps(xDistance), distanceY = _mm256_set1_ps(yDistance);
+	__m256 scaleX = _mm256_set1_ps(halfWidth), scaleY = _mm256_set1_ps(halfHeight);
+	int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256 sine, cosine;
+		sinCosAVX2(_mm256_add_ps(_mm256_loadu_ps(theta + i), offset), trigMode, sine, cosine);
+
+		__m256 sensorX = MULTIPLY_ADD256(distanceX, cosine, _mm256_loadu_ps(posX + i));
+		__m256 sensorY = MULTIPLY_ADD256(distanceY, sine, _mm256_loadu_ps(posY + i));
+		_mm256_storeu_si256((__m256i*)(cellX + i), _mm256_cvttps_epi32(MULTIPLY_ADD256(sensorX, scaleX, scaleX)));
+		_mm256_storeu_si256((__m256i*)(cellY + i), _mm256_cvttps_epi32(MULTIPLY_ADD256(sensorY, scaleY, scaleY)));
+	}
+
+	placeSensorsScalar(posX + i, posY + i, theta + i, xDistance, yDistance, positionAngle, halfWidth, halfHeight, cellX + i, cellY + i, count - i, trigMode);
+}
+
+__attribute__((target("avx2")))
+static inline void storeReadingsAVX2(__m256i red, __m256i green, __m256i blue, PheromoneReading* readings)
+{
+	alignas(32) int sums[PHEROMONE_CHANNELS][8];
+	_mm256_store_si256((__m256i*)sums[RED], red);
+	_mm256_store_si256((__m256i*)sums[GREEN], green);
+	_mm256_store_si256((__m256i*)sums[BLUE], blue);
+	for(int k = 0; k < 8; k++) readings[k] = {sums[RED][k], sums[GREEN][k], sums[BLUE][k]};
+}
+
+__attribute__((target("avx2")))
+static void summedAreaBoxSumsAVX2(uint32_t* const* tables, int width, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count)
+{
+	__m256i tableWidth = _mm256_set1_epi32(width + 1);
+	__m256i before = _mm256_set1_epi32(radius), after = _mm256_set1_epi32(radius + 1);
+	int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256i x = _mm256_loadu_si256((__m256i*)(cellX + i));
+		__m256i y = _mm256_loadu_si256((__m256i*)(cellY + i));
+		__m256i top = _mm256_mullo_epi32(_mm256_sub_epi32(y, before), tableWidth);
+		__m256i bottom = _mm256_mullo_epi32(_mm256_add_epi32(y, after), tableWidth);
+		__m256i left = _mm256_sub_epi32(x, before);
+		__m256i right = _mm256_add_epi32(x, after);
+
+		__m256i topLeft = _mm256_add_epi32(top, left), topRight = _mm256_add_epi32(top, right);
+		__m256i bottomLeft = _mm256_add_epi32(bottom, left), bottomRight = _mm256_add_epi32(bottom, right);
+
+		__m256i sums[PHEROMONE_CHANNELS];
+		for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+		{
+			const int* table = (const int*)tables[c];
+			__m256i sum = _mm256_sub_epi32(_mm256_i32gather_epi32(table, bottomRight, 4), _mm256_i32gather_epi32(table, topRight, 4));
+			sum = _mm256_sub_epi32(sum, _mm256_i32gather_epi32(table, bottomLeft, 4));
+			sums[c] = _mm256_add_epi32(sum, _mm256_i32gather_epi32(table, topLeft, 4));
+		}
+		storeReadingsAVX2(sums[RED], sums[GREEN], sums[BLUE], readings + i);
+	}
+
+	summedAreaBoxSumsScalar(tables, width, cellX + i, cellY + i, radius, readings + i, count - i);
+}
+
+// One 32 bit gather fetches R, G and B of a cell for 8 sensors at once
+__attribute__((target("avx2")))
+static void interleavedBoxSumsAVX2(const uint8_t* rgba, int width, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count)
+{
+	const int* pixels = (const int*)rgba;
+	__m256i byte = _mm256_set1_epi32(0xff);
+	int i = 0;
+
+	for(; i + 8 <= count; i += 8)
+	{
+		__m256i x = _mm256_loadu_si256((__m256i*)(cellX + i));
+		__m256i y = _mm256_loadu_si256((__m256i*)(cellY + i));
+		__m256i red = _mm256_setzero_si256(), green = _mm256_setzero_si256(), blue = _mm256_setzero_si256();
+
+		for(int dy = -radius; dy <= radius; dy++)
+		{
+			__m256i row = _mm256_add_epi32(_mm256_mullo_epi32(_mm256_add_epi32(y, _mm256_set1_epi32(dy)), _mm256_set1_epi32(width)), x);
+			for(int dx = -radius; dx <= radius; dx++)
+			{
+				__m256i pixel = _mm256_i32gather_epi32(pixels, _mm256_add_epi32(row, _mm256_set1_epi32(dx)), 4);
+				red = _mm256_add_epi32(red, _mm256_and_si256(pixel, byte));
+				green = _mm256_add_epi32(green, _mm256_and_si256(_mm256_srli_epi32(pixel, 8), byte));
+				blue = _mm256_add_epi32(blue, _mm256_and_si256(_mm256_srli_epi32(pixel, 16), byte));
+			}
+		}
+		storeReadingsAVX2(red, green, blue, readings + i);
+	}
+
+	interleavedBoxSumsScalar(rgba, width, cellX + i, cellY + i, radius, readings + i, count - i);
+}
+
+//=== AVX-512, 16 ants ===//
+
+// GCC 12 takes the undefined pass through vectors inside the AVX-512
+// conversion and gather intrinsics for uninitialized reads
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+__attribute__((target("avx512f")))
+static inline void sinCosAVX512(__m512 radians, TrigMode trigMode, __m512& sine, __m512& cosine)
+{
+	if(trigMode == POLYNOMIAL_TRIG)
+	{
+		__m512i q = _mm512_cvtps_epi32(_mm512_mul_ps(radians, _mm512_set1_ps(TRIG_TWO_OVER_PI)));
+		__m512 quadrant = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_cvtepi32_ps(q)), _mm512_set1_epi32(INT_MIN)));
+		__m512 x = MULTIPLY_ADD512(quadrant, _mm512_set1_ps(TRIG_HALF_PI_1), radians);
+		x = MULTIPLY_ADD512(quadrant, _mm512_set1_ps(TRIG_HALF_PI_2), x);
+		x = MULTIPLY_ADD512(quadrant, _mm512_set1_ps(TRIG_HALF_PI_3), x);
+		__m512 x2 = _mm512_mul_ps(x, x);
+
+		__m512 s = MULTIPLY_ADD512(_mm512_set1_ps(TRIG_SIN_3), x2, _mm512_set1_ps(TRIG_SIN_2));
+		s = MULTIPLY_ADD512(s, x2, _mm512_set1_ps(TRIG_SIN_1));
+		s = MULTIPLY_ADD512(s, _mm512_mul_ps(x2, x), x);
+		__m512 c = MULTIPLY_ADD512(_mm512_set1_ps(TRIG_COS_3), x2, _mm512_set1_ps(TRIG_COS_2));
+		c = MULTIPLY_ADD512(c, x2, _mm512_set1_ps(TRIG_COS_1));
+		c = MULTIPLY_ADD512(c, _mm512_mul_ps(x2, x2), MULTIPLY_ADD512(_mm512_set1_ps(-0.5f), x2, _mm512_set1_ps(1.0f)));
+
+		__mmask16 swap = _mm512_test_epi32_mask(q, _mm512_set1_epi32(1));
+		__m512i sineSign = _mm512_slli_epi32(_mm512_and_si512(q, _mm512_set1_epi32(2)), 30);
+		__m512i cosineSign = _mm512_slli_epi32(_mm512_and_si512(_mm512_add_epi32(q, _mm512_set1_epi32(1)), _mm512_set1_epi32(2)), 30);
+		sine = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(swap, s, c)), sineSign));
+		cosine = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(_mm512_mask_blend_ps(swap, c, s)), cosineSign));
+		return;
+	}
+
+	__m512i index = _mm512_cvttps_epi32(_mm512_mul_ps(radians, _mm512_set1_ps(TRIG_STEPS_PER_RADIAN)));
+	__m512i turn = _mm512_set1_epi32(TRIG_TABLE_STEPS);
+	index = _mm512_mask_add_epi32(index, _mm512_cmplt_epi32_mask(index, _mm512_setzero_si512()), index, turn);
+	index = _mm512_mask_sub_epi32(index, _mm512_cmpge_epi32_mask(index, turn), index, turn);
+	cosine = _mm512_i32gather_ps(index, trigTables.cosine, 4);
+	sine = _mm512_i32gather_ps(index, trigTables.sine, 4);
+}
+
+__attribute__((target("avx512f")))
+static void sinCosAVX512(const float* radians, float* sine, float* cosine, int count, TrigMode trigMode)
+{
+	int i = 0;
+	for(; i + 16 <= count; i += 16)
+	{
+		__m512 s, c;
+		sinCosAVX512(_mm512_loadu_ps(radians + i), trigMode, s, c);
+		_mm512_storeu_ps(sine + i, s);
+		_mm512_storeu_ps(cosine + i, c);
+	}
+	sinCosAVX2(radians + i, sine + i, cosine + i, count - i, trigMode);
+}
+
+__attribute__((target("avx512f")))
+static void moveAVX512(float* posX, float* posY, const float* theta, float velocity, int count, TrigMode trigMode)
+{
+	__m512 speed = _mm512_set1_ps(velocity);
+	__m512 low = _mm512_set1_ps(-BORDER), high = _mm512_set1_ps(BORDER);
+	int i = 0;
+
+	for(; i + 16 <= count; i += 16)
+	{
+		__m512 sine, cosine;
+		sinCosAVX512(_mm512_loadu_ps(theta + i), trigMode, sine, cosine);
+
+		__m512 x = MULTIPLY_ADD512(speed, cosine, _mm512_loadu_ps(posX + i));
+		__m512 y = MULTIPLY_ADD512(speed, sine, _mm512_loadu_ps(posY + i));
+		_mm512_storeu_ps(posX + i, _mm512_min_ps(_mm512_max_ps(x, low), high));
+		_mm512_storeu_ps(posY + i, _mm512_min_ps(_mm512_max_ps(y, low), high));
+	}
+
+	moveAVX2(posX + i, posY + i, theta + i, velocity, count - i, trigMode);
+}
+
+__attribute__((target("avx512f")))
+static void placeSensorsAVX512(const float* posX, const float* posY, const float* theta, float xDistance, float yDistance, float positionAngle,
+	float halfWidth, float halfHeight, int* cellX, int* cellY, int count, TrigMode trigMode)
+{
+	__m512 offset = _mm512_set1_ps(positionAngle);
+	__m512 distanceX = _mm512_set1_ps(xDistance), distanceY = _mm512_set1_ps(yDistance);
+	__m512 scaleX = _mm512_set1_ps(halfWidth), scaleY = _mm512_set1_ps(halfHeight);
+	int i = 0;
+
+	for(; i + 16 <= count; i += 16)
+	{
+		__m512 sine, cosine;
+		sinCosAVX512(_mm512_add_ps(_mm512_loadu_ps(theta + i), offset), trigMode, sine, cosine);
+
+		__m512 sensorX = MULTIPLY_ADD512(distanceX, cosine, _mm512_loadu_ps(posX + i));
+		__m512 sensorY = MULTIPLY_ADD512(distanceY, sine, _mm512_loadu_ps(posY + i));
+		_mm512_storeu_si512((void*)(cellX + i), _mm512_cvttps_epi32(MULTIPLY_ADD512(sensorX, scaleX, scaleX)));
+		_mm512_storeu_si512((void*)(cellY + i), _mm512_cvttps_epi32(MULTIPLY_ADD512(sensorY, scaleY, scaleY)));
+	}
+
+	placeSensorsAVX2(posX + i, posY + i, theta + i, xDistance, yDistance, positionAngle, halfWidth, halfHeight, cellX + i, cellY + i, count - i, trigMode);
+}
+
+__attribute__((target("avx512f")))
+static inline void storeReadingsAVX512(__m512i red, __m512i green, __m512i blue, PheromoneReading* readings)
+{
+	alignas(64) int sums[PHEROMONE_CHANNELS][16];
+	_mm512_store_si512((void*)sums[RED], red);
+	_mm512_store_si512((void*)sums[GREEN], green);
+	_mm512_store_si512((void*)sums[BLUE], blue);
+	for(int k = 0; k < 16; k++) readings[k] = {sums[RED][k], sums[GREEN][k], sums[BLUE][k]};
+}
+
+__attribute__((target("avx512f")))
+static void summedAreaBoxSumsAVX512(uint32_t* const* tables, int width, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count)
+{
+	__m512i tableWidth = _mm512_set1_epi32(width + 1);
+	__m512i before = _mm512_set1_epi32(radius), after = _mm512_set1_epi32(radius + 1);
+	int i = 0;
+
+	for(; i + 16 <= count; i += 16)
+	{
+		__m512i x = _mm512_loadu_si512((void*)(cellX + i));
+		__m512i y = _mm512_loadu_si512((void*)(cellY + i));
+		__m512i top = _mm512_mullo_epi32(_mm512_sub_epi32(y, before), tableWidth);
+		__m512i bottom = _mm512_mullo_epi32(_mm512_add_epi32(y, after), tableWidth);
+		__m512i left = _mm512_sub_epi32(x, before);
+		__m512i right = _mm512_add_epi32(x, after);
+
+		__m512i topLeft = _mm512_add_epi32(top, left), topRight = _mm512_add_epi32(top, right);
+		__m512i bottomLeft = _mm512_add_epi32(bottom, left), bottomRight = _mm512_add_epi32(bottom, right);
+
+		__m512i sums[PHEROMONE_CHANNELS];
+		for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+		{
+			const int* table = (const int*)tables[c];
+			__m512i sum = _mm512_sub_epi32(_mm512_i32gather_epi32(bottomRight, table, 4), _mm512_i32gather_epi32(topRight, table, 4));
+			sum = _mm512_sub_epi32(sum, _mm512_i32gather_epi32(bottomLeft, table, 4));
+			sums[c] = _mm512_add_epi32(sum, _mm512_i32gather_epi32(topLeft, table, 4));
+		}
+		storeReadingsAVX512(sums[RED], sums[GREEN], sums[BLUE], readings + i);
+	}
+
+	summedAreaBoxSumsAVX2(tables, width, cellX + i, cellY + i, radius, readings + i, count - i);
+}
+
+__attribute__((target("avx512f")))
+static void interleavedBoxSumsAVX512(const uint8_t* rgba, int width, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count)
+{
+	const int* pixels = (const int*)rgba;
+	__m512i byte = _mm512_set1_epi32(0xff);
+	int i = 0;
+
+	for(; i + 16 <= count; i += 16)
+	{
+		__m512i x = _mm512_loadu_si512((void*)(cellX + i));
+		__m512i y = _mm512_loadu_si512((void*)(cellY + i));
+		__m512i red = _mm512_setzero_si512(), green = _mm512_setzero_si512(), blue = _mm512_setzero_si512();
+
+		for(int dy = -radius; dy <= radius; dy++)
+		{
+			__m512i row = _mm512_add_epi32(_mm512_mullo_epi32(_mm512_add_epi32(y, _mm512_set1_epi32(dy)), _mm512_set1_epi32(width)), x);
+			for(int dx = -radius; dx <= radius; dx++)
+			{
+				__m512i pixel = _mm512_i32gather_epi32(_mm512_add_epi32(row, _mm512_set1_epi32(dx)), pixels, 4);
+				red = _mm512_add_epi32(red, _mm512_and_si512(pixel, byte));
+				green = _mm512_add_epi32(green, _mm512_and_si512(_mm512_srli_epi32(pixel, 8), byte));
+				blue = _mm512_add_epi32(blue, _mm512_and_si512(_mm512_srli_epi32(pixel, 16), byte));
+			}
+		}
+		storeReadingsAVX512(red, green, blue, readings + i);
+	}
+
+	interleavedBoxSumsAVX2(rgba, width, cellX + i, cellY + i, radius, readings + i, count - i);
+}
+
+#pragma GCC diagnostic pop
+
+//=== DISPATCH ===//
+
+void sinCosKernel(const float* radians, float* sine, float* cosine, int count, TrigMode trigMode, SimdLevel simdLevel)
+{
+	switch(simdLevel)
+	{
+		case SIMD_AVX512: sinCosAVX512(radians, sine, cosine, count, trigMode); break;
+		case SIMD_AVX2: sinCosAVX2(radians, sine, cosine, count, trigMode); break;
+		case SIMD_SSE2: sinCosSSE2(radians, sine, cosine, count, trigMode); break;
+		default: sinCosScalar(radians, sine, cosine, count, trigMode); break;
+	}
+}
+
+void moveAntsKernel(float* posX, float* posY, const float* theta, float velocity, int count, TrigMode trigMode, SimdLevel simdLevel)
+{
+	switch(simdLevel)
+	{
+		case SIMD_AVX512: moveAVX512(posX, posY, theta, velocity, count, trigMode); break;
+		case SIMD_AVX2: moveAVX2(posX, posY, theta, velocity, count, trigMode); break;
+		case SIMD_SSE2: moveSSE2(posX, posY, theta, velocity, count, trigMode); break;
+		default: moveScalar(posX, posY, theta, velocity, count, trigMode); break;
+	}
+}
+
+void placeSensorsKernel(const float* posX, const float* posY, const float* theta, float xCenterAntDistance, float yCenterAntDistance, float positionAngle,
+	float halfWidth, float halfHeight, int* cellX, int* cellY, int count, TrigMode trigMode, SimdLevel simdLevel)
+{
+	switch(simdLevel)
+	{
+		case SIMD_AVX512: placeSensorsAVX512(posX, posY, theta, xCenterAntDistance, yCenterAntDistance, positionAngle, halfWidth, halfHeight, cellX, cellY, count, trigMode); break;
+		case SIMD_AVX2: placeSensorsAVX2(posX, posY, theta, xCenterAntDistance, yCenterAntDistance, positionAngle, halfWidth, halfHeight, cellX, cellY, count, trigMode); break;
+		case SIMD_SSE2: placeSensorsSSE2(posX, posY, theta, xCenterAntDistance, yCenterAntDistance, positionAngle, halfWidth, halfHeight, cellX, cellY, count, trigMode); break;
+		default: placeSensorsScalar(posX, posY, theta, xCenterAntDistance, yCenterAntDistance, positionAngle, halfWidth, halfHeight, cellX, cellY, count, trigMode); break;
+	}
+}
+
+// SSE2 has no gathers, the box sums stay scalar below AVX2
+void summedAreaBoxSumsKernel(uint32_t* const* tables, int width, int height, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count, SimdLevel simdLevel)
+{
+	if(!gatherable(((size_t)width + 1) * ((size_t)height + 1))) simdLevel = SIMD_SCALAR;
+
+	switch(simdLevel)
+	{
+		case SIMD_AVX512: summedAreaBoxSumsAVX512(tables, width, cellX, cellY, radius, readings, count); break;
+		case SIMD_AVX2: summedAreaBoxSumsAVX2(tables, width, cellX, cellY, radius, readings, count); break;
+		default: summedAreaBoxSumsScalar(tables, width, cellX, cellY, radius, readings, count); break;
+	}
+}
+
+void interleavedBoxSumsKernel(const uint8_t* rgba, int width, int height, const int* cellX, const int* cellY, int radius, PheromoneReading* readings, int count, SimdLevel simdLevel)
+{
+	if(!gatherable((size_t)width * height)) simdLevel = SIMD_SCALAR;
+
+	switch(simdLevel)
+	{
+		case SIMD_AVX512: interleavedBoxSumsAVX512(rgba, width, cellX, cellY, radius, readings, count); break;
+		case SIMD_AVX2: interleavedBoxSumsAVX2(rgba, width, cellX, cellY, radius, readings, count); break;
+		default: interleavedBoxSumsScalar(rgba, width, cellX, cellY, radius, readings, count); break;
+	}
+}
@@ -1,46 +1,39 @@
 #include <antSensor.h>
 
-AntSensor::AntSensor(int newId, AntSensorParameters* antSensorParameters)
+AntSensor::AntSensor(float newXCenterAntDistance, float newYCenterAntDistance, float newPositionAngle, int newSensorPixelRadius)
 {
-	id = newId;
 	posX = 0.0;
 	posY = 0.0;
 
-	xCenterAntDistance = antSensorParameters->xCenterAntDistance;
-	yCenterAntDistance = antSensorParameters->yCenterAntDistance;
-	positionAngle = glm::radians((float)antSensorParameters->positionAngle);
+	xCenterAntDistance = newXCenterAntDistance;
+	yCenterAntDistance = newYCenterAntDistance;
+	positionAngle = newPositionAngle;
 
-	sensorPixelRadius = antSensorParameters->sensorPixelRadius;
-	sensorType = antSensorParameters->sensorType;
+	sensorPixelRadius = newSensorPixelRadius;
 }	
 
-void AntSensor::move(float antPosX, float antPosY, float theta)
+void AntSensor::move(float antPosX, float antPosY, float theta, TrigMode trigMode)
 {
-	int angle = (int)(((theta+positionAngle)/M_PI)*1800);
-	if(angle < 0) angle += 3600;
-	if(angle >= 3600) angle -= 3600;
+	float sine, cosine;
+	sinCos(theta+positionAngle, trigMode, sine, cosine);
 
-	posX = antPosX + xCenterAntDistance*cosLookup[angle]; 
-	posY = antPosY + yCenterAntDistance*sinLookup[angle];
+	posX = antPosX + xCenterAntDistance*cosine; 
+	posY = antPosY + yCenterAntDistance*sine;
 
 	indexSensorX = ((PIXEL_WIDTH/2) + posX * (PIXEL_WIDTH/2));
 	indexSensorY = ((PIXEL_HEIGHT/2) + posY * (PIXEL_HEIGHT/2));
+
+	// Long sensors of an ant at the border would box outside the grid
+	indexSensorX = min(max(indexSensorX, sensorPixelRadius), (int)PIXEL_WIDTH - 1 - sensorPixelRadius);
+	indexSensorY = min(max(indexSensorY, sensorPixelRadius), (int)PIXEL_HEIGHT - 1 - sensorPixelRadius);
 }
 
-int AntSensor::detectPheromone(uint8_t* pheromoneMatrix, PheromoneType pheromoneType)
+int AntSensor::detectPheromone(PheromoneMatrix* pheromoneMatrix, PheromoneType pheromoneType)
 {
-	int pheromoneDetected = 0;
-	
-	int index;
-
-	for(int i = -sensorPixelRadius; i <= sensorPixelRadius; i++)
-	{
-		for(int j = -sensorPixelRadius; j <= sensorPixelRadius; j++)
-		{
-			index = ((indexSensorY+i) * PIXEL_WIDTH + (indexSensorX+j)) * 4;
-			pheromoneDetected += pheromoneMatrix[index+pheromoneType];
-		}
-	}
-
-	return pheromoneDetected;
-}
\ No newline at end of file
+	return pheromoneMatrix->boxSum(pheromoneType, indexSensorX, indexSensorY, sensorPixelRadius);
+}
+
+PheromoneReading AntSensor::detectPheromones(PheromoneMatrix* pheromoneMatrix)
+{
+	return pheromoneMatrix->boxSums(indexSensorX, indexSensorY, sensorPixelRadius);
+}
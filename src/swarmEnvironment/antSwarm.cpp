@@ -0,0 +1,520 @@
+#include <antSwarm.h>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+/*
+	TODO LIST:
+
+	1 - CONSERTAR SEED - OK
+	2 - FAZER A FORMIGA IR ATE O CENTRO ANTES DE VOLTAR OK
+	3 - range para que o sensor perceba o ninho e a comida (feromonio da comida e do ninho) OK
+	4 - Timeout/lifetime voltar a ser explorer OK
+	5 - Se explorer encontrar trilha verde vira nestcarriercopia OK
+*/
+
+// Reallocates one ant array with a new capacity keeping the first numberOfAnts
+// elements. Arrays of a snapshot mapping are left to the mapping.
+template <typename T>
+static void resizeArray(T*& array, int numberOfAnts, int newCapacity, bool mapped)
+{
+	size_t bytes = sizeof(T) * newCapacity;
+	bytes = (bytes + ANT_ARRAY_ALIGNMENT - 1) & ~((size_t)ANT_ARRAY_ALIGNMENT - 1);
+
+	T* newArray = (T*)aligned_alloc(ANT_ARRAY_ALIGNMENT, bytes);
+	if(array != NULL)
+	{
+		memcpy(newArray, array, sizeof(T) * numberOfAnts);
+		if(!mapped) free(array);
+	}
+	array = newArray;
+}
+
+AntSwarm::AntSwarm()
+{
+	storage = FLOAT_ANTS;
+	trigMode = TABLE_TRIG;
+	seed = GLOBAL_SEED;
+	numberOfAnts = 0;
+	capacity = 0;
+	mappedArrays = false;
+	maxSensorPixelRadius = 0;
+
+	species = NULL;
+
+	posX = NULL;
+	posY = NULL;
+	theta = NULL;
+	state = NULL;
+	pheromoneType = NULL;
+	carryingFood = NULL;
+	placePheromoneIntensity = NULL;
+	lifeTime = NULL;
+
+	fixedX = NULL;
+	fixedY = NULL;
+	heading = NULL;
+	flags = NULL;
+	intensity = NULL;
+	age = NULL;
+}
+
+AntSwarm::~AntSwarm()
+{
+	freeArrays();
+}
+
+void AntSwarm::freeArrays()
+{
+	forEachArray([&](auto*& array)
+	{
+		if(!mappedArrays) free(array);
+		array = NULL;
+	});
+	mappedArrays = false;
+}
+
+void AntSwarm::setStorage(AntStorage newStorage)
+{
+	if(newStorage == storage) return;
+
+	// Arrays of the previous storage are dropped with their capacity
+	freeArrays();
+	capacity = 0;
+	storage = newStorage;
+}
+
+size_t AntSwarm::bytesPerAnt()
+{
+	if(storage == FLOAT_ANTS)
+		return sizeof(*species) + sizeof(*posX) + sizeof(*posY) + sizeof(*theta) + sizeof(*state) + sizeof(*pheromoneType) +
+			sizeof(*carryingFood) + sizeof(*placePheromoneIntensity) + sizeof(*lifeTime);
+	return sizeof(*species) + sizeof(*fixedX) + sizeof(*fixedY) + sizeof(*heading) + sizeof(*flags) + sizeof(*intensity) + sizeof(*age);
+}
+
+void AntSwarm::reserve(int newCapacity)
+{
+	if(newCapacity <= capacity) return;
+
+	// Only the arrays of the storage in use are allocated
+	forEachArray([&](auto*& array) { resizeArray(array, numberOfAnts, newCapacity, mappedArrays); });
+
+	mappedArrays = false;
+	capacity = newCapacity;
+}
+
+void AntSwarm::clear()
+{
+	numberOfAnts = 0;
+	maxSensorPixelRadius = 0;
+	allSpecies.clear();
+}
+
+void AntSwarm::adoptMappedArrays(uint8_t* const* arrays, int newNumberOfAnts)
+{
+	freeArrays();
+
+	int k = 0;
+	forEachArray([&](auto*& array) { array = (remove_reference_t<decltype(array)>)arrays[k++]; });
+
+	mappedArrays = true;
+	numberOfAnts = newNumberOfAnts;
+	capacity = newNumberOfAnts;
+
+	maxSensorPixelRadius = 0;
+	for(AntSpecies& antSpecies : allSpecies)
+		for(int side = 0; side < SENSORS_PER_ANT; side++) maxSensorPixelRadius = max(maxSensorPixelRadius, antSpecies.sensorPixelRadius[side]);
+}
+
+int AntSwarm::addAnt(float newPosX, float newPosY, AntParameters* antParameters)
+{
+	if(numberOfAnts == capacity) reserve(max(2*capacity, 1024));
+
+	int i = numberOfAnts;
+
+	// Ants created from the same parameters share one species entry
+	int s = 0;
+	while(s < (int)allSpecies.size() && allSpecies[s].antParameters != antParameters) s++;
+	if(s == (int)allSpecies.size())
+	{
+		AntSpecies antSpecies;
+		loadSpecies(antSpecies, antParameters);
+		allSpecies.push_back(antSpecies);
+	}
+	species[i] = s;
+
+	Ant ant;
+	ant.posX = newPosX;
+	ant.posY = newPosY;
+	ant.theta = degreesToRadians((float)(CounterRandom(seed, i, 0, SPAWN_STREAM).next()%360));
+
+	ant.state = antParameters->state;
+	ant.pheromoneType = 1;
+	ant.carryingFood = false;
+	ant.placePheromoneIntensity = antParameters->placePheromoneIntensity;
+	ant.lifeTime = 0;
+
+	store(i, ant, 0);
+	numberOfAnts++;
+
+	return i;
+}
+
+void AntSwarm::updateSpecies()
+{
+	maxSensorPixelRadius = 0;
+	for(AntSpecies& antSpecies : allSpecies)
+	{
+		// Species restored from a snapshot may have lost their parameters
+		if(antSpecies.antParameters != NULL) loadSpecies(antSpecies, antSpecies.antParameters);
+		for(int side = 0; side < SENSORS_PER_ANT; side++) maxSensorPixelRadius = max(maxSensorPixelRadius, antSpecies.sensorPixelRadius[side]);
+	}
+}
+
+void AntSwarm::loadSpecies(AntSpecies& antSpecies, AntParameters* antParameters)
+{
+	antSpecies.antParameters = antParameters;
+	antSpecies.nestID = antParameters->nestID;
+	antSpecies.size = antParameters->size;
+	antSpecies.velocity = antParameters->velocity;
+	antSpecies.viewFrequency = antParameters->viewFrequency;
+
+	AntSensorParameters* sensorParameters[SENSORS_PER_ANT];
+	sensorParameters[SENSOR_RIGHT] = antParameters->antSensorParameters;
+	sensorParameters[SENSOR_LEFT] = antParameters->antSensorParameters2;
+
+	for(int side = 0; side < SENSORS_PER_ANT; side++)
+	{
+		antSpecies.sensorXCenterAntDistance[side] = sensorParameters[side]->xCenterAntDistance;
+		antSpecies.sensorYCenterAntDistance[side] = sensorParameters[side]->yCenterAntDistance;
+		antSpecies.sensorPositionAngle[side] = degreesToRadians((float)sensorParameters[side]->positionAngle);
+		antSpecies.sensorPixelRadius[side] = sensorParameters[side]->sensorPixelRadius;
+		maxSensorPixelRadius = max(maxSensorPixelRadius, antSpecies.sensorPixelRadius[side]);
+	}
+}
+
+AntSensor AntSwarm::sensor(AntSpecies& antSpecies, AntSensorSide side)
+{
+	return AntSensor(antSpecies.sensorXCenterAntDistance[side], antSpecies.sensorYCenterAntDistance[side], antSpecies.sensorPositionAngle[side], antSpecies.sensorPixelRadius[side]);
+}
+
+template <int STATE>
+void AntSwarm::step(int i, int frameCounter, uint64_t tick, PheromoneMatrix* pheromoneMatrix, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex)
+{
+	Ant ant = load(i);
+	AntSpecies& antSpecies = speciesOf(i);
+
+	move(ant, antSpecies);
+	environmentAnalysis<STATE>(i, ant, antSpecies, frameCounter, tick, pheromoneMatrix, nestIndex, foodIndex);
+
+	store(i, ant, tick);
+}
+
+void AntSwarm::stepRange(int begin, int end, int frameCounter, uint64_t tick, PheromoneMatrix* pheromoneMatrix, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex, SimdLevel simdLevel)
+{
+	PheromoneReading readings[SENSORS_PER_ANT][ANT_KERNEL_BATCH];
+
+	for(int batchBegin = begin; batchBegin < end;)
+	{
+		// The kernels take the geometry of one species
+		int batchEnd = batchBegin + 1;
+		while(batchEnd < end && batchEnd - batchBegin < ANT_KERNEL_BATCH && species[batchEnd] == species[batchBegin]) batchEnd++;
+		int count = batchEnd - batchBegin;
+		AntSpecies& antSpecies = speciesOf(batchBegin);
+
+		for(int i = batchBegin; i < batchEnd; i++) lifeTime[i]++;
+		moveAntsKernel(posX + batchBegin, posY + batchBegin, theta + batchBegin, antSpecies.velocity, count, trigMode, simdLevel);
+
+		if(frameCounter % antSpecies.viewFrequency == 0)
+		{
+			senseBatch(batchBegin, count, antSpecies, pheromoneMatrix, readings, simdLevel);
+
+			for(int k = 0; k < count; k++)
+			{
+				int i = batchBegin + k;
+				Ant ant = load(i);
+				makeDecision(i, ant, tick, nestIndex, foodIndex, readings[SENSOR_LEFT][k], readings[SENSOR_RIGHT][k]);
+				wrapTheta(ant);
+				store(i, ant, tick);
+			}
+		}
+
+		batchBegin = batchEnd;
+	}
+}
+
+void AntSwarm::senseBatch(int begin, int count, AntSpecies& antSpecies, PheromoneMatrix* pheromoneMatrix, PheromoneReading readings[SENSORS_PER_ANT][ANT_KERNEL_BATCH], SimdLevel simdLevel)
+{
+	int cellX[ANT_KERNEL_BATCH], cellY[ANT_KERNEL_BATCH];
+
+	for(int side = 0; side < SENSORS_PER_ANT; side++)
+	{
+		placeSensorsKernel(posX + begin, posY + begin, theta + begin, antSpecies.sensorXCenterAntDistance[side], antSpecies.sensorYCenterAntDistance[side],
+			antSpecies.sensorPositionAngle[side], PIXEL_WIDTH/2, PIXEL_HEIGHT/2, cellX, cellY, count, trigMode, simdLevel);
+
+		// Long sensors of an ant at the border would box outside the grid
+		int radius = antSpecies.sensorPixelRadius[side];
+		int lastX = pheromoneMatrix->width - 1 - radius, lastY = pheromoneMatrix->height - 1 - radius;
+		for(int k = 0; k < count; k++)
+		{
+			cellX[k] = min(max(cellX[k], radius), lastX);
+			cellY[k] = min(max(cellY[k], radius), lastY);
+		}
+
+		// Tiled, lazy and planar fields keep the box walk of the matrix
+		if(pheromoneMatrix->summedAreaReady)
+			summedAreaBoxSumsKernel(pheromoneMatrix->summedArea, pheromoneMatrix->width, pheromoneMatrix->height, cellX, cellY, radius, readings[side], count, simdLevel);
+		else if(pheromoneMatrix->layout == INTERLEAVED_RGBA && pheromoneMatrix->evaporationMode == EAGER_EVAPORATION)
+			interleavedBoxSumsKernel(pheromoneMatrix->data, pheromoneMatrix->width, pheromoneMatrix->height, cellX, cellY, radius, readings[side], count, simdLevel);
+		else
+			for(int k = 0; k < count; k++) readings[side][k] = pheromoneMatrix->boxSums(cellX[k], cellY[k], radius);
+	}
+}
+
+void AntSwarm::move(Ant& ant, AntSpecies& antSpecies)
+{
+	ant.lifeTime++;
+	float sine, cosine;
+	sinCos(ant.theta, trigMode, sine, cosine);
+
+	ant.posX += antSpecies.velocity*cosine;
+	ant.posY += antSpecies.velocity*sine;
+
+	//Border treatment
+	if(ant.posX < -0.990f || ant.posX > 0.990f)
+	{
+		ant.posX = ant.posX < 0 ? -0.990f : 0.990f;
+	}
+
+	if(ant.posY < -0.990f || ant.posY > 0.990f)
+	{
+		ant.posY = ant.posY < 0 ? -0.990f : 0.990f;
+	}
+
+}
+
+template <int STATE>
+void AntSwarm::environmentAnalysis(int i, Ant& ant, AntSpecies& antSpecies, int frameCounter, uint64_t tick, PheromoneMatrix* pheromoneMatrix, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex)
+{
+	if(frameCounter % antSpecies.viewFrequency == 0)
+	{
+		AntSensor pheromoneSensorL = sensor(antSpecies, SENSOR_LEFT);
+		AntSensor pheromoneSensorR = sensor(antSpecies, SENSOR_RIGHT);
+
+		pheromoneSensorL.move(ant.posX, ant.posY, ant.theta, trigMode);
+		pheromoneSensorR.move(ant.posX, ant.posY, ant.theta, trigMode);
+
+		PheromoneReading left = pheromoneSensorL.detectPheromones(pheromoneMatrix);
+		PheromoneReading right = pheromoneSensorR.detectPheromones(pheromoneMatrix);
+		if constexpr(STATE == ANY_ANT_STATE) makeDecision(i, ant, tick, nestIndex, foodIndex, left, right);
+		else decide<(AntStates)STATE>(i, ant, tick, nestIndex, foodIndex, left, right);
+
+		// Border Treatment
+		//if(xSensorL < -0.990f || xSensorL > 0.990f || ySensorL < -0.990f || ySensorL > 0.990f) theta += degreesToRadians((float)(rand()%360)/10.0f-1.0f)*4.0f;
+		//else if(xSensorR < -0.990f || xSensorR > 0.990f || ySensorR < -0.990f || ySensorR > 0.990f) theta -= degreesToRadians((float)(rand()%360)/10.0f-1.0f)*4.0f;
+
+		wrapTheta(ant);
+	}
+}
+
+bool AntSwarm::foodColision(Ant& ant, LandmarkIndex<FoodSource>* foodIndex)
+{
+	FoodSource* food = foodIndex->find(ant.posX, ant.posY);
+	if(food == NULL) return false;
+
+	ant.posX = food->posX;
+	ant.posY = food->posY;
+	ant.carryingFood = true;
+	if(food->take()) foodIndex->retire(food);
+	return true;
+}
+
+bool AntSwarm::nestColision(Ant& ant, LandmarkIndex<Anthill>* nestIndex)
+{
+	Anthill* anthill = nestIndex->find(ant.posX, ant.posY);
+	if(anthill == NULL) return false;
+
+	ant.posX = anthill->posX;
+	ant.posY = anthill->posY;
+	ant.carryingFood = false;
+	return true;
+}
+
+void AntSwarm::changeState(Ant& ant, AntStates newState)
+{
+	switch(newState)
+	{
+		case EXPLORER:
+
+			ant.state = EXPLORER;
+			ant.pheromoneType = 1;
+			ant.placePheromoneIntensity = 60;
+
+		break;
+
+		case BACKHOME:
+
+			ant.theta += degreesToRadians((float)(180.0f));
+			ant.state = BACKHOME;
+			ant.pheromoneType = -1;
+
+		break;
+
+		case CARRIER:
+
+			ant.state = CARRIER;
+			ant.pheromoneType = 2;
+			ant.placePheromoneIntensity = 60;
+
+		break;
+
+		case NESTCARRIER:
+
+			ant.state = NESTCARRIER;
+			ant.pheromoneType = 2;
+			ant.placePheromoneIntensity = 60;
+
+		break;
+
+		case FOLLOWGREEN:
+
+			ant.state = FOLLOWGREEN;
+			ant.pheromoneType = -1;
+
+		break;
+
+		default:
+		break;
+	}
+}
+
+template <AntStates STATE>
+void AntSwarm::decide(int i, Ant& ant, uint64_t tick, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex, PheromoneReading left, PheromoneReading right)
+{
+	CounterRandom random(seed, i, tick, DECISION_STREAM);
+
+	int lR = left.red, lG = left.green;
+	int rR = right.red, rG = right.green;
+
+	if constexpr(STATE == EXPLORER)
+	{
+		if(rR > lR)
+			ant.theta += degreesToRadians((float)(random.next()%360)/6.0f)*0.1f;
+		else  if(rR < lR)
+			ant.theta -= degreesToRadians((float)(random.next()%360)/6.0f)*0.1f;
+
+		if(rG > 0 || lG > 0)
+		{
+			changeState(ant, FOLLOWGREEN);
+		}
+
+		if(foodColision(ant, foodIndex))
+		{
+			ant.theta += degreesToRadians((float)(180.0f));
+			ant.lifeTime = 0;
+
+			changeState(ant, CARRIER);
+		}
+	}
+	else if constexpr(STATE == BACKHOME)
+	{
+		if(rR > lR)
+			ant.theta -= degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+		else  if(rR < lR)
+			ant.theta += degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+
+		if(nestColision(ant, nestIndex))
+		{
+			ant.theta += degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+			ant.theta -= degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+			ant.lifeTime = 0;
+
+			changeState(ant, EXPLORER);
+		}
+	}
+	else if constexpr(STATE == CARRIER)
+	{
+		if(rG > lG)
+			ant.theta += degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+		else if(rG < lG)
+			ant.theta -= degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+
+		if(rR > lR)
+			ant.theta -= degreesToRadians((float)(random.next()%360)/6.0f)*0.1f;
+		else if(rR < lR)
+			ant.theta += degreesToRadians((float)(random.next()%360)/6.0f)*0.1f;
+
+		if(nestColision(ant, nestIndex))
+		{
+			ant.theta += degreesToRadians((float)(180.0f));
+			ant.lifeTime = 0;
+
+			changeState(ant, NESTCARRIER);
+		}
+	}
+	else if constexpr(STATE == NESTCARRIER)
+	{
+		if(rG  > lG)
+			ant.theta -= degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+		else if(rG < lG)
+			ant.theta += degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+
+		if(ant.carryingFood == true && nestColision(ant, nestIndex))
+		{
+			ant.lifeTime = 0;
+			ant.theta += degreesToRadians((float)(180.0f));
+			ant.placePheromoneIntensity = 60;
+		}
+
+		else if(ant.carryingFood == false && foodColision(ant, foodIndex))
+		{
+
+			ant.theta += degreesToRadians((float)(180.0f));
+			ant.placePheromoneIntensity = 60;
+		}
+	}
+	else if constexpr(STATE == FOLLOWGREEN)
+	{
+		if(rG  > lG)
+			ant.theta -= degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+		else if(rG < lG)
+			ant.theta += degreesToRadians((float)(random.next()%360)/6.0f)*0.4f;
+
+		if(nestColision(ant, nestIndex))
+		{
+			changeState(ant, EXPLORER);
+		}
+
+		else if(foodColision(ant, foodIndex))
+		{
+			changeState(ant, CARRIER);
+		}
+	}
+
+	if(ant.lifeTime%10 == 0) ant.placePheromoneIntensity = max(0, ant.placePheromoneIntensity - 3);
+	if(ant.lifeTime >= 200)
+	{
+		ant.lifeTime = 0;
+		ant.posX = 0;
+		ant.posY = 0;
+		changeState(ant, NESTCARRIER);
+	}
+}
+
+void AntSwarm::makeDecision(int i, Ant& ant, uint64_t tick, LandmarkIndex<Anthill>* nestIndex, LandmarkIndex<FoodSource>* foodIndex, PheromoneReading left, PheromoneReading right)
+{
+	switch(ant.state)
+	{
+		case EXPLORER: decide<EXPLORER>(i, ant, tick, nestIndex, foodIndex, left, right); break;
+		case BACKHOME: decide<BACKHOME>(i, ant, tick, nestIndex, foodIndex, left, right); break;
+		case CARRIER: decide<CARRIER>(i, ant, tick, nestIndex, foodIndex, left, right); break;
+		case NESTCARRIER: decide<NESTCARRIER>(i, ant, tick, nestIndex, foodIndex, left, right); break;
+		case FOLLOWGREEN: decide<FOLLOWGREEN>(i, ant, tick, nestIndex, foodIndex, left, right); break;
+	}
+}
+
+template void AntSwarm::step<ANY_ANT_STATE>(int, int, uint64_t, PheromoneMatrix*, LandmarkIndex<Anthill>*, LandmarkIndex<FoodSource>*);
+template void AntSwarm::step<EXPLORER>(int, int, uint64_t, PheromoneMatrix*, LandmarkIndex<Anthill>*, LandmarkIndex<FoodSource>*);
+template void AntSwarm::step<BACKHOME>(int, int, uint64_t, PheromoneMatrix*, LandmarkIndex<Anthill>*, LandmarkIndex<FoodSource>*);
+template void AntSwarm::step<CARRIER>(int, int, uint64_t, PheromoneMatrix*, LandmarkIndex<Anthill>*, LandmarkIndex<FoodSource>*);
+template void AntSwarm::step<NESTCARRIER>(int, int, uint64_t, PheromoneMatrix*, LandmarkIndex<Anthill>*, LandmarkIndex<FoodSource>*);
+template void AntSwarm::step<FOLLOWGREEN>(int, int, uint64_t, PheromoneMatrix*, LandmarkIndex<Anthill>*, LandmarkIndex<FoodSource>*);
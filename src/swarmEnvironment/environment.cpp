@@ -1,72 +1,129 @@
 #include <environment.h>
+#include <algorithm>
 #include <iostream>
 
 Environment::Environment(ParameterAssigner* parameterAssigner)
 {
 	this->parameterAssigner = parameterAssigner;
+	threadPool = new ThreadPool(parameterAssigner->environmentParameters.numberOfThreads);
 
-	pheromoneMatrix = (uint8_t*)malloc(sizeof(uint8_t) * DATA_SIZE);
+	pheromoneMatrix = new PheromoneMatrix(PIXEL_WIDTH, PIXEL_HEIGHT, parameterAssigner->environmentParameters.pheromoneLayout, parameterAssigner->environmentParameters.evaporationMode);
+
+	// 16 bit positions cannot address every cell of a larger world
+	AntStorage antStorage = parameterAssigner->environmentParameters.antStorage;
+	if(antStorage == COMPACT_ANTS && max(PIXEL_WIDTH, PIXEL_HEIGHT) > FIXED_POSITION_MAX_CELLS)
+	{
+		cout << "compact ants cannot tell the cells of a " << PIXEL_WIDTH << "x" << PIXEL_HEIGHT << " world apart, using float storage" << endl;
+		antStorage = FLOAT_ANTS;
+	}
+	ants.setStorage(antStorage);
+	ants.trigMode = parameterAssigner->environmentParameters.trigMode;
+	updateMode = parameterAssigner->environmentParameters.updateMode;
+	simdLevel = detectSimdLevel();
+
+	snapshotMapping = NULL;
+	snapshotMappingBytes = 0;
+
+	trajectoryRecorder = NULL;
+	EnvironmentParameters& parameters = parameterAssigner->environmentParameters;
+	if(!parameters.trajectoryPath.empty())
+	{
+		trajectoryRecorder = new TrajectoryRecorder(parameters.trajectoryPath.c_str(), ants.storage, parameters.trajectoryInterval, parameters.trajectoryPolicy);
+		if(!trajectoryRecorder->isOpen())
+		{
+			delete trajectoryRecorder;
+			trajectoryRecorder = NULL;
+		}
+	}
+
+	pheromoneRecorder = NULL;
+	if(!parameters.pheromonePath.empty())
+	{
+		pheromoneRecorder = new PheromoneRecorder(parameters.pheromonePath.c_str(), PIXEL_WIDTH, PIXEL_HEIGHT, parameters.pheromoneInterval, parameters.pheromoneKeyframeInterval);
+		if(!pheromoneRecorder->isOpen())
+		{
+			delete pheromoneRecorder;
+			pheromoneRecorder = NULL;
+		}
+	}
+
+	// Rasters at the resolution of the pheromone grid, one load per collision test
+	collisionMode = parameterAssigner->environmentParameters.collisionMode;
+	if(collisionMode == RASTER_COLLISION)
+	{
+		nestIndex.useRaster(PIXEL_WIDTH, PIXEL_HEIGHT);
+		foodIndex.useRaster(PIXEL_WIDTH, PIXEL_HEIGHT);
+	}
 }
 
-void Environment::initializeEnvironment(OpenglBuffersManager* openglBuffersManager)
+Environment::~Environment()
 {
-    for(int i = 0; i < DATA_SIZE; i+=4) pheromoneMatrix[i] = 0; //R
-    for(int i = 1; i < DATA_SIZE; i+=4) pheromoneMatrix[i] = 0; //G
-    for(int i = 2; i < DATA_SIZE; i+=4) pheromoneMatrix[i] = 0; //B   
-    for(int i = 3; i < DATA_SIZE; i+=4) pheromoneMatrix[i] = 255; //A
+	// Flush the frames still in their rings before the ants and the field go away
+	delete trajectoryRecorder;
+	delete pheromoneRecorder;
+	for(Anthill* anthill : nests) delete anthill;
+	for(FoodSource* food : foods) delete food;
+	delete pheromoneMatrix;
+	delete threadPool;
+	// The ant arrays of the mapping are left alone by the swarm destructor
+	releaseSnapshot();
+}
+
+void Environment::initializeEnvironment()
+{
+    pheromoneMatrix->clear();
 
 	numberOfNests = 0;
 	numberOfFoods = 0;
 	numberOfAnts = 0;
+	tick = 0;
 
 	placePheromoneRate = parameterAssigner->environmentParameters.placePheromoneRate;
 	pheromoneEvaporationRate = parameterAssigner->environmentParameters.pheromoneEvaporationRate;
+	sensingMode = parameterAssigner->environmentParameters.sensingMode;
+	evaporationMode = parameterAssigner->environmentParameters.evaporationMode;
 }
 
 void Environment::resetEnvironment()
 {
 	nests.clear();
 	foods.clear();
+	nestIndex.clear();
+	foodIndex.clear();
 	ants.clear();
 	numberOfNests = 0;
 	numberOfFoods = 0;
 	numberOfAnts = 0;
-	for(int i = 0; i < DATA_SIZE; i+=4) pheromoneMatrix[i] = 0; //R
-    for(int i = 1; i < DATA_SIZE; i+=4) pheromoneMatrix[i] = 0; //G
-    for(int i = 2; i < DATA_SIZE; i+=4) pheromoneMatrix[i] = 0; //B   
-    for(int i = 3; i < DATA_SIZE; i+=4) pheromoneMatrix[i] = 255; //A
+	tick = 0;
+	pheromoneMatrix->clear();
 
     placePheromoneRate = 1;
 	pheromoneEvaporationRate = 1;
 }
 
-void Environment::createNest(int idNest, OpenglBuffersManager* openglBuffersManager)
+void Environment::createNest(int idNest)
 {  
 	AnthillParameters* anthillParameters = parameterAssigner->anthillParameters[idNest];
     
     Anthill* anthill = new Anthill(anthillParameters);
     nests.push_back(anthill);
+    nestIndex.insert(anthill);
     
     numberOfNests++;
-
-    openglBuffersManager->addElement(&(openglBuffersManager->anthillsTransformationMatrices), anthill->size, anthill->posX, anthill->posY, 0.0f);
-    openglBuffersManager->updateBuffer(openglBuffersManager->anthillsTransformationMatricesVBO, numberOfNests, openglBuffersManager->anthillsTransformationMatrices, GL_STATIC_DRAW);
 }
 
-void Environment::createFoodSource(int idFood, OpenglBuffersManager* openglBuffersManager)
+void Environment::createFoodSource(int idFood)
 {
 	FoodSourceParameters* foodParameters = parameterAssigner->foodParameters[idFood];
 
 	FoodSource* food = new FoodSource(foodParameters);
     foods.push_back(food);
+    foodIndex.insert(food);
     
     numberOfFoods++; 
-
-    openglBuffersManager->addElement(&(openglBuffersManager->foodsTransformationMatrices), food->size, food->posX, food->posY, 0.0f);
-    openglBuffersManager->updateBuffer(openglBuffersManager->foodsTransformationMatricesVBO, numberOfFoods, openglBuffersManager->foodsTransformationMatrices, GL_STATIC_DRAW);
 }
 
-void Environment::createAnt(int idNest, OpenglBuffersManager* openglBuffersManager)
+void Environment::createAnt(int idNest)
 {
 	int antEspecificationIndex = parameterAssigner->anthillParameters[idNest]->antEspecification;
 	
@@ -76,90 +133,189 @@ void Environment::createAnt(int idNest, OpenglBuffersManager* openglBuffersManag
 
 	AntParameters* antParameters = parameterAssigner->antParameters[antEspecificationIndex];
 
+	ants.reserve(numberOfAnts + antAmount);
+
 	for(int i = 0; i < antAmount; i++)
 	{
-	 	Ant* ant = new Ant(numberOfAnts, posX, posY, antParameters);
-	    ants.push_back(ant);
+	 	ants.addAnt(posX, posY, antParameters);
 	    
 	    numberOfAnts++;
-
-	    openglBuffersManager->addElement(&(openglBuffersManager->antsTransformationMatrices), ant->size, ant->posX, ant->posY, ant->theta);
 	}
-	openglBuffersManager->updateBuffer(openglBuffersManager->antsTransformationMatricesVBO, numberOfAnts, openglBuffersManager->antsTransformationMatrices, GL_DYNAMIC_DRAW);
 }
 
 void Environment::run(int frameCounter)
 {
+	TRACE_SCOPE("Environment::run");
+
 	moveAnts(frameCounter); // TODO CUDA
 
 	placePheromone(frameCounter); 
 
 	pheromoneEvaporation(frameCounter);  
+
+	tick++;
+
+	if(trajectoryRecorder != NULL) trajectoryRecorder->record(&ants, tick);
+	if(pheromoneRecorder != NULL) pheromoneRecorder->record(pheromoneMatrix, threadPool, tick);
 }
 
-void Environment::draw(OpenglBuffersManager* openglBuffersManager, Camera* camera)
+bool Environment::useSummedAreaSensing()
 {
-	openglBuffersManager->updateModelAnts(numberOfAnts, ants);
-	openglBuffersManager->drawAnts(numberOfAnts, camera);  
-	openglBuffersManager->drawAnthills(numberOfNests, camera);
-	openglBuffersManager->drawFoods(numberOfFoods, camera);
-	openglBuffersManager->drawPheromone(pheromoneMatrix, camera); 
+	// The tables would be as large as the world, the tiles exist to avoid that
+	if(pheromoneMatrix->layout == TILED) return false;
+
+	if(sensingMode == AUTO_SENSING)
+	{
+		// Building the tables costs a few passes over the grid, direct sensing costs
+		// a box per sensor, the tables win once the boxes cover more than the grid
+		size_t radius = ants.maxSensorPixelRadius;
+		return (size_t)numberOfAnts * radius * radius > pheromoneMatrix->numberOfCells;
+	}
+	return sensingMode == SUMMED_AREA_SENSING;
 }
 
 void Environment::moveAnts(int frameCounter)
 {
-	for (int i = 0; i < numberOfAnts; i++)
-    {      
-		ants[i]->move(frameCounter);
-        ants[i]->environmentAnalysis(frameCounter, pheromoneMatrix, nests, foods);
-    }
+	TRACE_SCOPE("Environment::moveAnts");
+
+	bool summedArea = useSummedAreaSensing();
+	if(summedArea) pheromoneMatrix->buildSummedArea(threadPool);
+
+	// Ants only read the pheromone matrix here and only write their own slots,
+	// so any split or order of the ants gives the same result
+	if(updateMode == PARTITIONED_UPDATE)
+	{
+		partitionAntsByState();
+		moveAntsInState<EXPLORER>(frameCounter);
+		moveAntsInState<BACKHOME>(frameCounter);
+		moveAntsInState<CARRIER>(frameCounter);
+		moveAntsInState<NESTCARRIER>(frameCounter);
+		moveAntsInState<FOLLOWGREEN>(frameCounter);
+	}
+	else
+	{
+		// Compact ants are unpacked one at a time, float ants go through the kernels
+		threadPool->parallelFor(0, numberOfAnts, ANT_CHUNK_SIZE, [&](int begin, int end, int threadIndex)
+		{
+			if(ants.storage == FLOAT_ANTS) ants.stepRange(begin, end, frameCounter, tick, pheromoneMatrix, &nestIndex, &foodIndex, simdLevel);
+			else for (int i = begin; i < end; i++) ants.step(i, frameCounter, tick, pheromoneMatrix, &nestIndex, &foodIndex);
+		});
+	}
+
+	if(summedArea) pheromoneMatrix->invalidateSummedArea();
+
+	removeEmptyFoodSources();
+}
+
+void Environment::partitionAntsByState()
+{
+	TRACE_SCOPE("Environment::partitionAntsByState");
+
+	// Counting sort in two parallel passes over fixed chunks of ants: count the
+	// states of every chunk, then scatter each chunk from its own offsets
+	int numberOfChunks = (numberOfAnts + ANT_CHUNK_SIZE - 1) / ANT_CHUNK_SIZE;
+	chunkStateOffsets.assign((size_t)numberOfChunks * NUMBER_OF_ANT_STATES, 0);
+	antsByState.resize(numberOfAnts);
+
+	auto forEachChunk = [&](function<void(int chunk, int begin, int end)> body)
+	{
+		threadPool->parallelFor(0, numberOfAnts, ANT_CHUNK_SIZE, [&](int begin, int end, int threadIndex)
+		{
+			// A single thread gets the whole range at once
+			for (int chunkBegin = begin; chunkBegin < end; chunkBegin += ANT_CHUNK_SIZE)
+				body(chunkBegin / ANT_CHUNK_SIZE, chunkBegin, min(chunkBegin + ANT_CHUNK_SIZE, end));
+		});
+	};
+
+	forEachChunk([&](int chunk, int begin, int end)
+	{
+		int* counts = &chunkStateOffsets[(size_t)chunk * NUMBER_OF_ANT_STATES];
+		for (int i = begin; i < end; i++) counts[ants.stateOf(i)]++;
+	});
+
+	int offset = 0;
+	for (int s = 0; s < NUMBER_OF_ANT_STATES; s++)
+	{
+		stateBegin[s] = offset;
+		for (int c = 0; c < numberOfChunks; c++)
+		{
+			int& chunkOffset = chunkStateOffsets[(size_t)c * NUMBER_OF_ANT_STATES + s];
+			int count = chunkOffset;
+			chunkOffset = offset;
+			offset += count;
+		}
+	}
+	stateBegin[NUMBER_OF_ANT_STATES] = offset;
+
+	forEachChunk([&](int chunk, int begin, int end)
+	{
+		int* next = &chunkStateOffsets[(size_t)chunk * NUMBER_OF_ANT_STATES];
+		for (int i = begin; i < end; i++) antsByState[next[ants.stateOf(i)]++] = i;
+	});
+}
+
+template <AntStates STATE>
+void Environment::moveAntsInState(int frameCounter)
+{
+	threadPool->parallelFor(stateBegin[STATE], stateBegin[STATE + 1], ANT_CHUNK_SIZE, [&](int begin, int end, int threadIndex)
+	{
+		for (int k = begin; k < end; k++) ants.step<STATE>(antsByState[k], frameCounter, tick, pheromoneMatrix, &nestIndex, &foodIndex);
+	});
+}
+
+void Environment::removeEmptyFoodSources()
+{
+	// Sources emptied during the tick leave the index only now, ants that
+	// reached one in the same tick still took their food
+	vector<FoodSource*> removed = foodIndex.removeRetired();
+	if(removed.empty()) return;
+
+	sort(removed.begin(), removed.end());
+	foods.erase(remove_if(foods.begin(), foods.end(), [&](FoodSource* food) { return binary_search(removed.begin(), removed.end(), food); }), foods.end());
+	for(FoodSource* food : removed) delete food;
+	numberOfFoods = foods.size();
 }
 
 void Environment::placePheromone(int frameCounter)
 {
+	TRACE_SCOPE("Environment::placePheromone");
+
 	if (frameCounter % placePheromoneRate == 0)
     {
-	    for (int i = 0; i < numberOfAnts; i++)
-	    {
-	    	Ant* currentAnt = ants[i];
-
-	        int xn, yn, index;
-	      
-	        xn = ((PIXEL_WIDTH/2) + currentAnt->posX * (PIXEL_WIDTH/2));
-	        yn = ((PIXEL_HEIGHT/2) + currentAnt->posY * (PIXEL_HEIGHT/2));
-	        index = (yn * PIXEL_WIDTH) + xn;
+	    // Pheromone types 1, 2 and 3 go to the RED, GREEN and BLUE channels
+	    auto depositing = [&](const Ant& ant) { return ant.pheromoneType >= 1 && ant.pheromoneType <= 3; };
+	    auto cellX = [&](const Ant& ant) { return (int)((PIXEL_WIDTH/2) + ant.posX * (PIXEL_WIDTH/2)); };
+	    auto cellY = [&](const Ant& ant) { return (int)((PIXEL_HEIGHT/2) + ant.posY * (PIXEL_HEIGHT/2)); };
 
-	        if (currentAnt->pheromoneType == 1)
-	        {	        	
-	            pheromoneMatrix[index*4] = min((int)(pheromoneMatrix[index*4] + currentAnt->placePheromoneIntensity), 255);
-	        }
-	        else if (currentAnt->pheromoneType == 2)
+	    // Tiles and lazy blocks are made ready one ant at a time, then the adds
+	    // run in parallel and commute, any split gives the same field
+	    if (pheromoneMatrix->depositsNeedPreparation())
+	    {
+	        for (int i = 0; i < numberOfAnts; i++)
 	        {
-	            pheromoneMatrix[(index*4)+1] = min((int)(pheromoneMatrix[(index*4)+1] + currentAnt->placePheromoneIntensity), 255);
+	            Ant ant = ants.load(i);
+	            if (depositing(ant)) pheromoneMatrix->prepareDeposit(cellX(ant), cellY(ant));
 	        }
-	        else if (currentAnt->pheromoneType == 3)
+	    }
+
+	    threadPool->parallelFor(0, numberOfAnts, ANT_CHUNK_SIZE, [&](int begin, int end, int threadIndex)
+	    {
+	        for (int i = begin; i < end; i++)
 	        {
-	            pheromoneMatrix[(index*4)+2] = min((int)(pheromoneMatrix[(index*4)+2] + currentAnt->placePheromoneIntensity), 255);
+	            Ant ant = ants.load(i);
+	            if (depositing(ant)) pheromoneMatrix->depositAtomic(ant.pheromoneType - 1, cellX(ant), cellY(ant), ant.placePheromoneIntensity);
 	        }
-		}
+	    });
 	}
 }
 
 void Environment::pheromoneEvaporation(int frameCounter)
 {
+	TRACE_SCOPE("Environment::pheromoneEvaporation");
+
 	if (frameCounter % pheromoneEvaporationRate == 0)
     {
-	    for(int i = 0; i < DATA_SIZE; i+=4)
-	    {
-	        pheromoneMatrix[i] = max((int)pheromoneMatrix[i]-1, 0);
-	    }
-	    for(int i = 1; i < DATA_SIZE; i+=4)
-	    {
-	        pheromoneMatrix[i] = max((int)pheromoneMatrix[i]-1, 0);
-	    }
-	    for(int i = 2; i < DATA_SIZE; i+=4)
-	    {
-	        pheromoneMatrix[i] = max((int)pheromoneMatrix[i]-1, 0);
-	    }
+	    // One saturating subtract pass over R, G and B, split in bands of rows
+	    pheromoneMatrix->evaporate(threadPool);
 	}
 }
\ No newline at end of file
@@ -0,0 +1,378 @@
+#include <evolutionaryAlgorithm.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <numeric>
+
+// Ranges wide enough to hold the species of the experiment. A sensor radius
+// past 8 cells costs more than a tick of movement, an intensity past 255 does
+// not fit compact ants. Sensors reaching past the border are clamped back into
+// the grid when they are placed.
+const GeneRange GENE_RANGES[NUMBER_OF_GENES] =
+{
+	{"velocity", 0.0001f, 0.002f, false},
+	{"placePheromoneIntensity", 10.0f, 255.0f, true},
+	{"right.xCenterAntDistance", 0.001f, 0.012f, false},
+	{"right.yCenterAntDistance", 0.001f, 0.012f, false},
+	{"right.positionAngle", -90.0f, 90.0f, true},
+	{"right.sensorPixelRadius", 1.0f, 8.0f, true},
+	{"left.xCenterAntDistance", 0.001f, 0.012f, false},
+	{"left.yCenterAntDistance", 0.001f, 0.012f, false},
+	{"left.positionAngle", -90.0f, 90.0f, true},
+	{"left.sensorPixelRadius", 1.0f, 8.0f, true}
+};
+
+// BLEND_CROSSOVER draws each gene up to this fraction of the gap between the
+// parents outside of it
+#define BLEND_ALPHA 0.5f
+
+// Evaluations poll for a stop every this many ticks
+#define EVALUATION_STOP_TICKS 64
+
+// [0, 1)
+static inline float uniformDraw(CounterRandom& random)
+{
+	return (random.next() >> 8) * (1.0f / 16777216.0f);
+}
+
+// Box-Muller, the first draw is kept away from 0
+static inline float gaussianDraw(CounterRandom& random)
+{
+	float radius = sqrtf(-2.0f * logf(((random.next() >> 8) + 1) * (1.0f / 16777216.0f)));
+	return radius * cosf(2.0f * (float)M_PI * uniformDraw(random));
+}
+
+static void fitRanges(Individual* individual)
+{
+	for(int g = 0; g < NUMBER_OF_GENES; g++)
+	{
+		float gene = min(max(individual->genes[g], GENE_RANGES[g].minimum), GENE_RANGES[g].maximum);
+		individual->genes[g] = GENE_RANGES[g].integer ? roundf(gene) : gene;
+	}
+}
+
+EvolutionaryAlgorithm::EvolutionaryAlgorithm(ParameterAssigner* parameterAssigner, EvolutionParameters newParameters) : experiment(*parameterAssigner)
+{
+	parameters = newParameters;
+	parameters.populationSize = max(parameters.populationSize, 2);
+	parameters.elitism = min(max(parameters.elitism, 0), parameters.populationSize);
+	parameters.tournamentSize = max(parameters.tournamentSize, 1);
+	parameters.antEspecification = min(max(parameters.antEspecification, 0), (int)experiment.antParameters.size() - 1);
+
+	// Field by field, the parameters of the experiment are malloc'd and their
+	// vector was never constructed
+	AntParameters* original = experiment.antParameters[parameters.antEspecification];
+	species.nestID = original->nestID;
+	species.size = original->size;
+	species.velocity = original->velocity;
+	species.state = original->state;
+	species.pheromoneType = original->pheromoneType;
+	species.placePheromoneIntensity = original->placePheromoneIntensity;
+	species.lifeTime = original->lifeTime;
+	species.viewFrequency = original->viewFrequency;
+	sensors[SENSOR_RIGHT] = *original->antSensorParameters;
+	sensors[SENSOR_LEFT] = *original->antSensorParameters2;
+	species.antSensorParameters = &sensors[SENSOR_RIGHT];
+	species.antSensorParameters2 = &sensors[SENSOR_LEFT];
+
+	// Evaluations run side by side, one thread each, and record nothing
+	experiment.environmentParameters.numberOfThreads = 1;
+	experiment.environmentParameters.trajectoryPath = "";
+	experiment.environmentParameters.pheromonePath = "";
+
+	threadPool = new ThreadPool(parameters.numberOfThreads);
+
+	// The species of the experiment and random individuals around it
+	generation = 0;
+	population.resize(parameters.populationSize);
+	encode(&species, &population[0]);
+	for(int i = 1; i < parameters.populationSize; i++)
+	{
+		CounterRandom random(parameters.seed, i, 0, EVOLUTION_STREAM);
+		for(int g = 0; g < NUMBER_OF_GENES; g++)
+			population[i].genes[g] = GENE_RANGES[g].minimum + uniformDraw(random) * (GENE_RANGES[g].maximum - GENE_RANGES[g].minimum);
+		fitRanges(&population[i]);
+		population[i].fitness = -1;
+	}
+
+	running.store(false);
+	stopping.store(false);
+}
+
+EvolutionaryAlgorithm::~EvolutionaryAlgorithm()
+{
+	stop();
+	delete threadPool;
+}
+
+bool EvolutionaryAlgorithm::runGeneration()
+{
+	TRACE_SCOPE("EvolutionaryAlgorithm::runGeneration");
+
+	auto start = chrono::steady_clock::now();
+	uint32_t seed = evaluationSeed(generation);
+
+	// One individual per chunk, evaluations differ too much in length to
+	// hand them out in larger ones. The elites are evaluated again, every
+	// generation draws other ants.
+	threadPool->parallelFor(0, population.size(), 1, [&](int begin, int end, int threadIndex)
+	{
+		for(int i = begin; i < end; i++) population[i].fitness = evaluate(population[i], seed);
+	});
+	if(stopping.load()) return false;
+
+	GenerationResult result;
+	result.generation = generation;
+	result.seed = seed;
+	result.best = population[0];
+	result.meanFitness = 0;
+	for(Individual& individual : population)
+	{
+		if(individual.fitness > result.best.fitness) result.best = individual;
+		result.meanFitness += individual.fitness;
+	}
+	result.bestFitness = result.best.fitness;
+	result.meanFitness /= population.size();
+	result.seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	{
+		lock_guard<mutex> lock(resultsMutex);
+		history.push_back(result);
+	}
+
+	breed();
+	generation++;
+	return true;
+}
+
+void EvolutionaryAlgorithm::start()
+{
+	if(running.load() || generation >= parameters.generations) return;
+
+	// A run that finished by itself left its thread to join
+	if(worker.joinable()) worker.join();
+
+	running.store(true);
+	worker = thread(&EvolutionaryAlgorithm::workerLoop, this);
+}
+
+void EvolutionaryAlgorithm::stop()
+{
+	if(!worker.joinable()) return;
+
+	stopping.store(true);
+	worker.join();
+	stopping.store(false);
+}
+
+bool EvolutionaryAlgorithm::isRunning()
+{
+	return running.load();
+}
+
+vector<GenerationResult> EvolutionaryAlgorithm::results()
+{
+	lock_guard<mutex> lock(resultsMutex);
+	return history;
+}
+
+uint32_t EvolutionaryAlgorithm::evaluationSeed(int generation)
+{
+	// No individual has this index, the stream is free
+	return CounterRandom(parameters.seed, UINT32_MAX, generation, EVOLUTION_STREAM).next();
+}
+
+void EvolutionaryAlgorithm::encode(AntParameters* antParameters, Individual* individual)
+{
+	AntSensorParameters* right = antParameters->antSensorParameters;
+	AntSensorParameters* left = antParameters->antSensorParameters2;
+
+	individual->genes[GENE_VELOCITY] = antParameters->velocity;
+	individual->genes[GENE_PLACE_PHEROMONE_INTENSITY] = antParameters->placePheromoneIntensity;
+	individual->genes[GENE_RIGHT_X_DISTANCE] = right->xCenterAntDistance;
+	individual->genes[GENE_RIGHT_Y_DISTANCE] = right->yCenterAntDistance;
+	individual->genes[GENE_RIGHT_ANGLE] = right->positionAngle;
+	individual->genes[GENE_RIGHT_RADIUS] = right->sensorPixelRadius;
+	individual->genes[GENE_LEFT_X_DISTANCE] = left->xCenterAntDistance;
+	individual->genes[GENE_LEFT_Y_DISTANCE] = left->yCenterAntDistance;
+	individual->genes[GENE_LEFT_ANGLE] = left->positionAngle;
+	individual->genes[GENE_LEFT_RADIUS] = left->sensorPixelRadius;
+	individual->fitness = -1;
+}
+
+void EvolutionaryAlgorithm::decode(const Individual& individual, AntParameters* antParameters)
+{
+	AntSensorParameters* right = antParameters->antSensorParameters;
+	AntSensorParameters* left = antParameters->antSensorParameters2;
+
+	antParameters->velocity = individual.genes[GENE_VELOCITY];
+	antParameters->placePheromoneIntensity = lroundf(individual.genes[GENE_PLACE_PHEROMONE_INTENSITY]);
+	right->xCenterAntDistance = individual.genes[GENE_RIGHT_X_DISTANCE];
+	right->yCenterAntDistance = individual.genes[GENE_RIGHT_Y_DISTANCE];
+	right->positionAngle = lroundf(individual.genes[GENE_RIGHT_ANGLE]);
+	right->sensorPixelRadius = lroundf(individual.genes[GENE_RIGHT_RADIUS]);
+	left->xCenterAntDistance = individual.genes[GENE_LEFT_X_DISTANCE];
+	left->yCenterAntDistance = individual.genes[GENE_LEFT_Y_DISTANCE];
+	left->positionAngle = lroundf(individual.genes[GENE_LEFT_ANGLE]);
+	left->sensorPixelRadius = lroundf(individual.genes[GENE_LEFT_RADIUS]);
+}
+
+string EvolutionaryAlgorithm::describe(const Individual& individual)
+{
+	string description;
+	char line[128];
+	for(int g = 0; g < NUMBER_OF_GENES; g++)
+	{
+		snprintf(line, sizeof(line), "%s %.6g\n", GENE_RANGES[g].name, individual.genes[g]);
+		description += line;
+	}
+	return description;
+}
+
+double EvolutionaryAlgorithm::evaluate(const Individual& individual, uint32_t seed)
+{
+	TRACE_SCOPE("EvolutionaryAlgorithm::evaluate");
+
+	// The experiment with the species replaced by the individual
+	AntSensorParameters individualSensors[SENSORS_PER_ANT] = {sensors[SENSOR_RIGHT], sensors[SENSOR_LEFT]};
+	AntParameters antParameters = species;
+	antParameters.antSensorParameters = &individualSensors[SENSOR_RIGHT];
+	antParameters.antSensorParameters2 = &individualSensors[SENSOR_LEFT];
+	decode(individual, &antParameters);
+
+	ParameterAssigner parameterAssigner = experiment;
+	parameterAssigner.antParameters[parameters.antEspecification] = &antParameters;
+
+	Environment environment(&parameterAssigner);
+	environment.initializeEnvironment();
+	environment.ants.seed = seed;
+
+	for(size_t i = 0; i < parameterAssigner.anthillParameters.size(); i++) environment.createNest(i);
+	for(size_t i = 0; i < parameterAssigner.foodParameters.size(); i++) environment.createFoodSource(i);
+	for(size_t i = 0; i < parameterAssigner.anthillParameters.size(); i++) environment.createAnt(i);
+
+	// Same frame counter as the windowed and the headless loops
+	unsigned int frameCounter = 0;
+	for(int t = 0; t < parameters.evaluationTicks; t++)
+	{
+		if(t % EVALUATION_STOP_TICKS == 0 && stopping.load(memory_order_relaxed)) return -1;
+
+		frameCounter = (frameCounter + 1) % 1000;
+		environment.run(frameCounter);
+	}
+
+	// Emptied sources have left the environment, all of their food was taken
+	double foodTaken = 0;
+	for(FoodSourceParameters* food : parameterAssigner.foodParameters) foodTaken += food->foodAmount;
+	for(FoodSource* food : environment.foods) foodTaken -= food->foodAmount;
+	return foodTaken;
+}
+
+void EvolutionaryAlgorithm::breed()
+{
+	// Best first, ties keep the order of the population
+	vector<int> order(population.size());
+	iota(order.begin(), order.end(), 0);
+	stable_sort(order.begin(), order.end(), [&](int a, int b) { return population[a].fitness > population[b].fitness; });
+
+	double totalFitness = 0;
+	for(Individual& individual : population) totalFitness += max(individual.fitness, 0.0);
+
+	vector<Individual> children(population.size());
+	for(int c = 0; c < (int)children.size(); c++)
+	{
+		if(c < parameters.elitism)
+		{
+			children[c] = population[order[c]];
+			continue;
+		}
+
+		CounterRandom random(parameters.seed, c, generation + 1, EVOLUTION_STREAM);
+		const Individual& first = population[select(random, totalFitness)];
+		const Individual& second = population[select(random, totalFitness)];
+
+		if(uniformDraw(random) < parameters.crossoverRate) crossover(first, second, random, &children[c]);
+		else children[c] = first;
+		mutate(random, &children[c]);
+	}
+
+	for(Individual& child : children) child.fitness = -1;
+	population.swap(children);
+}
+
+int EvolutionaryAlgorithm::select(CounterRandom& random, double totalFitness)
+{
+	int size = population.size();
+
+	if(parameters.selection == ROULETTE_SELECTION)
+	{
+		// Nothing to weigh while no individual took any food
+		if(totalFitness <= 0) return random.next() % size;
+
+		double target = uniformDraw(random) * totalFitness;
+		for(int i = 0; i < size; i++)
+		{
+			target -= max(population[i].fitness, 0.0);
+			if(target < 0) return i;
+		}
+		return size - 1;
+	}
+
+	int winner = random.next() % size;
+	for(int k = 1; k < parameters.tournamentSize; k++)
+	{
+		int contender = random.next() % size;
+		if(population[contender].fitness > population[winner].fitness) winner = contender;
+	}
+	return winner;
+}
+
+void EvolutionaryAlgorithm::crossover(const Individual& first, const Individual& second, CounterRandom& random, Individual* child)
+{
+	switch(parameters.crossover)
+	{
+		case UNIFORM_CROSSOVER:
+		{
+			uint32_t fromSecond = random.next();
+			for(int g = 0; g < NUMBER_OF_GENES; g++) child->genes[g] = (fromSecond >> g) & 1 ? second.genes[g] : first.genes[g];
+		} break;
+
+		case ONE_POINT_CROSSOVER:
+		{
+			int point = 1 + random.next() % (NUMBER_OF_GENES - 1);
+			for(int g = 0; g < NUMBER_OF_GENES; g++) child->genes[g] = g < point ? first.genes[g] : second.genes[g];
+		} break;
+
+		case BLEND_CROSSOVER:
+		{
+			for(int g = 0; g < NUMBER_OF_GENES; g++)
+			{
+				float low = min(first.genes[g], second.genes[g]);
+				float gap = max(first.genes[g], second.genes[g]) - low;
+				child->genes[g] = low - BLEND_ALPHA * gap + uniformDraw(random) * (1.0f + 2.0f * BLEND_ALPHA) * gap;
+			}
+		} break;
+	}
+	fitRanges(child);
+}
+
+void EvolutionaryAlgorithm::mutate(CounterRandom& random, Individual* child)
+{
+	for(int g = 0; g < NUMBER_OF_GENES; g++)
+	{
+		if(uniformDraw(random) >= parameters.mutationRate) continue;
+
+		float range = GENE_RANGES[g].maximum - GENE_RANGES[g].minimum;
+		if(parameters.mutation == GAUSSIAN_MUTATION) child->genes[g] += gaussianDraw(random) * parameters.mutationScale * range;
+		else child->genes[g] = GENE_RANGES[g].minimum + uniformDraw(random) * range;
+	}
+	fitRanges(child);
+}
+
+void EvolutionaryAlgorithm::workerLoop()
+{
+	while(generation < parameters.generations && runGeneration());
+	running.store(false);
+}
@@ -1,4 +1,5 @@
 #include <foodSource.h>
+#include <cmath>
 #include <iostream>
 
 FoodSource::FoodSource(FoodSourceParameters* foodParameters)
@@ -7,7 +8,10 @@ FoodSource::FoodSource(FoodSourceParameters* foodParameters)
     posX = foodParameters->posX;
     posY = foodParameters->posY;
     size = foodParameters->size;
-    foodAmount = foodParameters->foodAmount;
+    foodAmount = max(foodParameters->foodAmount, 0);
+    initialAmount = foodAmount;
+    retired = false;
+    changed = false;
 }
 
 bool FoodSource::antColision(float antPosx, float antPosY)
@@ -19,4 +23,22 @@ bool FoodSource::antColision(float antPosx, float antPosY)
         return true;
     else
         return false;      
+}
+
+bool FoodSource::take()
+{
+    int amount = __atomic_load_n(&foodAmount, __ATOMIC_RELAXED);
+    while(amount > 0 && !__atomic_compare_exchange_n(&foodAmount, &amount, amount - 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+    if(amount > 0) __atomic_store_n(&changed, true, __ATOMIC_RELAXED);
+
+    // Takes that find the source already empty retire it too, a source that
+    // starts empty has no take down to zero
+    if(amount > 1) return false;
+    return !__atomic_exchange_n(&retired, true, __ATOMIC_RELAXED);
+}
+
+float FoodSource::drawnSize()
+{
+    if(initialAmount == 0) return size;
+    return size * sqrtf((float)__atomic_load_n(&foodAmount, __ATOMIC_RELAXED) / initialAmount);
 }
\ No newline at end of file
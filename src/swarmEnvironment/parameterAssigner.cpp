@@ -26,12 +26,88 @@ ParameterAssigner::ParameterAssigner(const char* filePath)
 	document.Parse(jsonString.c_str());
 
     setGlobalSeed(document["randomSeed"].GetInt());
-    //A DEFINIÇÃO DO DATA_SIZE ACONTECE ANTES DAQUI NO .H, PRECISA RESOLVER ISSO
-    //setScrHeight(2000);
-    //setScrWidth(2000);
+    // World resolution in cells, every grid and the pheromone texture are sized
+    // from it when the environment is built
+    int worldWidth = document["environment"].HasMember("worldWidth") ? document["environment"]["worldWidth"].GetInt() : 2000;
+    int worldHeight = document["environment"].HasMember("worldHeight") ? document["environment"]["worldHeight"].GetInt() : 2000;
+    if(worldWidth < MIN_WORLD_SIDE || worldWidth > MAX_WORLD_SIDE || worldHeight < MIN_WORLD_SIDE || worldHeight > MAX_WORLD_SIDE)
+    {
+        cout << "ERROR::PARAMETERS::WORLD_SIZE_OUT_OF_RANGE " << worldWidth << "x" << worldHeight << ", using 2000x2000" << endl;
+        worldWidth = worldHeight = 2000;
+    }
+    setScrWidth(worldWidth);
+    setScrHeight(worldHeight);
 
 	environmentParameters.placePheromoneRate = document["environment"]["placePheromoneRate"].GetInt();
    	environmentParameters.pheromoneEvaporationRate = document["environment"]["pheromoneEvaporationRate"].GetInt();
+   	// 0 means one thread per hardware thread
+   	environmentParameters.numberOfThreads = document["environment"].HasMember("numberOfThreads") ? document["environment"]["numberOfThreads"].GetInt() : 0;
+   	environmentParameters.pheromoneLayout = INTERLEAVED_RGBA;
+   	if(document["environment"].HasMember("pheromoneLayout"))
+   	{
+   		string pheromoneLayout = document["environment"]["pheromoneLayout"].GetString();
+   		if(pheromoneLayout == "planar") environmentParameters.pheromoneLayout = PLANAR;
+   		else if(pheromoneLayout == "tiled") environmentParameters.pheromoneLayout = TILED;
+   	}
+   	environmentParameters.sensingMode = AUTO_SENSING;
+   	if(document["environment"].HasMember("sensingMode"))
+   	{
+   		string sensingMode = document["environment"]["sensingMode"].GetString();
+   		if(sensingMode == "direct") environmentParameters.sensingMode = DIRECT_SENSING;
+   		else if(sensingMode == "summedArea") environmentParameters.sensingMode = SUMMED_AREA_SENSING;
+   	}
+   	environmentParameters.evaporationMode = EAGER_EVAPORATION;
+   	if(document["environment"].HasMember("evaporationMode") && string(document["environment"]["evaporationMode"].GetString()) == "lazy")
+   		environmentParameters.evaporationMode = LAZY_EVAPORATION;
+   	environmentParameters.collisionMode = INDEX_COLLISION;
+   	if(document["environment"].HasMember("collisionMode") && string(document["environment"]["collisionMode"].GetString()) == "raster")
+   		environmentParameters.collisionMode = RASTER_COLLISION;
+   	environmentParameters.antStorage = FLOAT_ANTS;
+   	if(document["environment"].HasMember("antStorage") && string(document["environment"]["antStorage"].GetString()) == "compact")
+   		environmentParameters.antStorage = COMPACT_ANTS;
+   	environmentParameters.updateMode = MIXED_UPDATE;
+   	if(document["environment"].HasMember("updateMode") && string(document["environment"]["updateMode"].GetString()) == "partitioned")
+   		environmentParameters.updateMode = PARTITIONED_UPDATE;
+   	environmentParameters.trigMode = TABLE_TRIG;
+   	if(document["environment"].HasMember("trigMode") && string(document["environment"]["trigMode"].GetString()) == "polynomial")
+   		environmentParameters.trigMode = POLYNOMIAL_TRIG;
+   	environmentParameters.trajectoryPath = document["environment"].HasMember("trajectoryPath") ? document["environment"]["trajectoryPath"].GetString() : "";
+   	environmentParameters.trajectoryInterval = document["environment"].HasMember("trajectoryInterval") ? max(document["environment"]["trajectoryInterval"].GetInt(), 1) : 10;
+   	environmentParameters.trajectoryPolicy = DROP_FRAMES;
+   	if(document["environment"].HasMember("trajectoryPolicy") && string(document["environment"]["trajectoryPolicy"].GetString()) == "throttle")
+   		environmentParameters.trajectoryPolicy = THROTTLE_FRAMES;
+   	environmentParameters.pheromonePath = document["environment"].HasMember("pheromonePath") ? document["environment"]["pheromonePath"].GetString() : "";
+   	environmentParameters.pheromoneInterval = document["environment"].HasMember("pheromoneInterval") ? max(document["environment"]["pheromoneInterval"].GetInt(), 1) : 50;
+   	environmentParameters.pheromoneKeyframeInterval = document["environment"].HasMember("pheromoneKeyframeInterval") ? max(document["environment"]["pheromoneKeyframeInterval"].GetInt(), 1) : 20;
+
+   	// Evolutionary algorithm, every key is optional
+   	Value noEvolution(kObjectType);
+   	const Value& evolution = document.HasMember("evolution") ? document["evolution"] : noEvolution;
+   	evolutionParameters.antEspecification = evolution.HasMember("antEspecification") ? evolution["antEspecification"].GetInt() : 0;
+   	evolutionParameters.populationSize = evolution.HasMember("populationSize") ? max(evolution["populationSize"].GetInt(), 2) : 32;
+   	evolutionParameters.generations = evolution.HasMember("generations") ? max(evolution["generations"].GetInt(), 1) : 20;
+   	evolutionParameters.evaluationTicks = evolution.HasMember("evaluationTicks") ? max(evolution["evaluationTicks"].GetInt(), 1) : 2000;
+   	evolutionParameters.elitism = evolution.HasMember("elitism") ? max(evolution["elitism"].GetInt(), 0) : 2;
+   	evolutionParameters.selection = TOURNAMENT_SELECTION;
+   	if(evolution.HasMember("selection") && string(evolution["selection"].GetString()) == "roulette")
+   		evolutionParameters.selection = ROULETTE_SELECTION;
+   	evolutionParameters.tournamentSize = evolution.HasMember("tournamentSize") ? max(evolution["tournamentSize"].GetInt(), 1) : 3;
+   	evolutionParameters.crossover = UNIFORM_CROSSOVER;
+   	if(evolution.HasMember("crossover"))
+   	{
+   		string crossover = evolution["crossover"].GetString();
+   		if(crossover == "onePoint") evolutionParameters.crossover = ONE_POINT_CROSSOVER;
+   		else if(crossover == "blend") evolutionParameters.crossover = BLEND_CROSSOVER;
+   	}
+   	evolutionParameters.crossoverRate = evolution.HasMember("crossoverRate") ? evolution["crossoverRate"].GetDouble() : 0.9;
+   	evolutionParameters.mutation = GAUSSIAN_MUTATION;
+   	if(evolution.HasMember("mutation") && string(evolution["mutation"].GetString()) == "uniform")
+   		evolutionParameters.mutation = UNIFORM_MUTATION;
+   	evolutionParameters.mutationRate = evolution.HasMember("mutationRate") ? evolution["mutationRate"].GetDouble() : 0.2;
+   	evolutionParameters.mutationScale = evolution.HasMember("mutationScale") ? evolution["mutationScale"].GetDouble() : 0.1;
+   	evolutionParameters.numberOfThreads = evolution.HasMember("numberOfThreads") ? evolution["numberOfThreads"].GetInt() : 0;
+   	// The experiment seed unless the evolution has its own
+   	evolutionParameters.seed = evolution.HasMember("seed") ? evolution["seed"].GetUint() : GLOBAL_SEED;
  
    	AnthillParameters* anthillParameterss = (AnthillParameters*) malloc(sizeof(AnthillParameters));
 	anthillParameterss->posX = document["anthills"][0]["posX"].GetDouble();
@@ -41,33 +117,18 @@ ParameterAssigner::ParameterAssigner(const char* filePath)
     anthillParameterss->antAmount = document["anthills"][0]["antAmounts"][0].GetInt();
     this->anthillParameters.push_back(anthillParameterss);
 
-    FoodSourceParameters* foodParameterss = (FoodSourceParameters*) malloc(sizeof(FoodSourceParameters));
-	foodParameterss->posX = document["foodSources"][0]["posX"].GetDouble();
-	foodParameterss->posY = document["foodSources"][0]["posY"].GetDouble();
-	foodParameterss->size = document["foodSources"][0]["size"].GetDouble();
-	foodParameterss->foodAmount = document["foodSources"][0]["foodAmount"].GetInt();
-	this->foodParameters.push_back(foodParameterss);
-
-	FoodSourceParameters* foodParametersss = (FoodSourceParameters*) malloc(sizeof(FoodSourceParameters));
-	foodParametersss->posX = document["foodSources"][1]["posX"].GetDouble();
-	foodParametersss->posY = document["foodSources"][1]["posY"].GetDouble();
-	foodParametersss->size = document["foodSources"][1]["size"].GetDouble();
-	foodParametersss->foodAmount = document["foodSources"][1]["foodAmount"].GetInt();
-	this->foodParameters.push_back(foodParametersss);
-
-	FoodSourceParameters* foodParameterssss = (FoodSourceParameters*) malloc(sizeof(FoodSourceParameters));
-	foodParameterssss->posX = document["foodSources"][2]["posX"].GetDouble();
-	foodParameterssss->posY = document["foodSources"][2]["posY"].GetDouble();
-	foodParameterssss->size = document["foodSources"][2]["size"].GetDouble();
-	foodParameterssss->foodAmount = document["foodSources"][2]["foodAmount"].GetInt();
-	this->foodParameters.push_back(foodParameterssss);
-
-	FoodSourceParameters* foodParametersssss = (FoodSourceParameters*) malloc(sizeof(FoodSourceParameters));
-	foodParametersssss->posX = document["foodSources"][3]["posX"].GetDouble();
-	foodParametersssss->posY = document["foodSources"][3]["posY"].GetDouble();
-	foodParametersssss->size = document["foodSources"][3]["size"].GetDouble();
-	foodParametersssss->foodAmount = document["foodSources"][3]["foodAmount"].GetInt();
-	this->foodParameters.push_back(foodParametersssss);
+	// Every food source of the file, scenarios can list thousands of them
+	const Value& foodSources = document["foodSources"];
+	for(SizeType f = 0; f < foodSources.Size(); f++)
+	{
+		FoodSourceParameters* foodParameterss = (FoodSourceParameters*) malloc(sizeof(FoodSourceParameters));
+		foodParameterss->id = f;
+		foodParameterss->posX = foodSources[f]["posX"].GetDouble();
+		foodParameterss->posY = foodSources[f]["posY"].GetDouble();
+		foodParameterss->size = foodSources[f]["size"].GetDouble();
+		foodParameterss->foodAmount = foodSources[f]["foodAmount"].GetInt();
+		this->foodParameters.push_back(foodParameterss);
+	}
 
 
 	AntSensorParameters* antSensorParameters = (AntSensorParameters*) malloc(sizeof(AntSensorParameters));
@@ -0,0 +1,157 @@
+#include <pheromoneKernels.h>
+#include <immintrin.h>
+#include <cstring>
+
+// Every kernel is compiled for its own instruction set and picked at runtime,
+// the rest of the build targets the baseline of the architecture, so the
+// binary still runs on CPUs older than the one it was built on (unless it was
+// built with make NATIVE=1)
+
+static void evaporateScalar(uint8_t* data, size_t bytes, uint32_t pattern)
+{
+	uint8_t decrement[4];
+	memcpy(decrement, &pattern, 4);
+
+	size_t i = 0;
+
+	for(; i + 4 <= bytes; i += 4)
+	{
+		for(int c = 0; c < 4; c++)
+			data[i + c] = data[i + c] > decrement[c] ? data[i + c] - decrement[c] : 0;
+	}
+	for(int c = 0; i < bytes; i++, c++)
+	{
+		data[i] = data[i] > decrement[c] ? data[i] - decrement[c] : 0;
+	}
+}
+
+__attribute__((target("sse2")))
+static void evaporateSSE2(uint8_t* data, size_t bytes, uint32_t pattern)
+{
+	__m128i decrement = _mm_set1_epi32((int)pattern);
+	size_t i = 0;
+
+	for(; i + 64 <= bytes; i += 64)
+	{
+		__m128i a = _mm_loadu_si128((__m128i*)(data + i));
+		__m128i b = _mm_loadu_si128((__m128i*)(data + i + 16));
+		__m128i c = _mm_loadu_si128((__m128i*)(data + i + 32));
+		__m128i d = _mm_loadu_si128((__m128i*)(data + i + 48));
+		_mm_storeu_si128((__m128i*)(data + i), _mm_subs_epu8(a, decrement));
+		_mm_storeu_si128((__m128i*)(data + i + 16), _mm_subs_epu8(b, decrement));
+		_mm_storeu_si128((__m128i*)(data + i + 32), _mm_subs_epu8(c, decrement));
+		_mm_storeu_si128((__m128i*)(data + i + 48), _mm_subs_epu8(d, decrement));
+	}
+	for(; i + 16 <= bytes; i += 16)
+	{
+		__m128i a = _mm_loadu_si128((__m128i*)(data + i));
+		_mm_storeu_si128((__m128i*)(data + i), _mm_subs_epu8(a, decrement));
+	}
+
+	evaporateScalar(data + i, bytes - i, pattern);
+}
+
+__attribute__((target("avx2")))
+static void evaporateAVX2(uint8_t* data, size_t bytes, uint32_t pattern)
+{
+	__m256i decrement = _mm256_set1_epi32((int)pattern);
+	size_t i = 0;
+
+	for(; i + 128 <= bytes; i += 128)
+	{
+		__m256i a = _mm256_loadu_si256((__m256i*)(data + i));
+		__m256i b = _mm256_loadu_si256((__m256i*)(data + i + 32));
+		__m256i c = _mm256_loadu_si256((__m256i*)(data + i + 64));
+		__m256i d = _mm256_loadu_si256((__m256i*)(data + i + 96));
+		_mm256_storeu_si256((__m256i*)(data + i), _mm256_subs_epu8(a, decrement));
+		_mm256_storeu_si256((__m256i*)(data + i + 32), _mm256_subs_epu8(b, decrement));
+		_mm256_storeu_si256((__m256i*)(data + i + 64), _mm256_subs_epu8(c, decrement));
+		_mm256_storeu_si256((__m256i*)(data + i + 96), _mm256_subs_epu8(d, decrement));
+	}
+	for(; i + 32 <= bytes; i += 32)
+	{
+		__m256i a = _mm256_loadu_si256((__m256i*)(data + i));
+		_mm256_storeu_si256((__m256i*)(data + i), _mm256_subs_epu8(a, decrement));
+	}
+
+	evaporateScalar(data + i, bytes - i, pattern);
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void evaporateAVX512(uint8_t* data, size_t bytes, uint32_t pattern)
+{
+	__m512i decrement = _mm512_set1_epi32((int)pattern);
+	size_t i = 0;
+
+	for(; i + 256 <= bytes; i += 256)
+	{
+		__m512i a = _mm512_loadu_si512((void*)(data + i));
+		__m512i b = _mm512_loadu_si512((void*)(data + i + 64));
+		__m512i c = _mm512_loadu_si512((void*)(data + i + 128));
+		__m512i d = _mm512_loadu_si512((void*)(data + i + 192));
+		_mm512_storeu_si512((void*)(data + i), _mm512_subs_epu8(a, decrement));
+		_mm512_storeu_si512((void*)(data + i + 64), _mm512_subs_epu8(b, decrement));
+		_mm512_storeu_si512((void*)(data + i + 128), _mm512_subs_epu8(c, decrement));
+		_mm512_storeu_si512((void*)(data + i + 192), _mm512_subs_epu8(d, decrement));
+	}
+
+	// Masked tail instead of a scalar one, it stays on 64 byte steps from data
+	// so the pattern phase is kept
+	for(; i < bytes; i += 64)
+	{
+		size_t remaining = bytes - i;
+		__mmask64 mask = remaining >= 64 ? ~(__mmask64)0 : (((__mmask64)1 << remaining) - 1);
+		__m512i a = _mm512_maskz_loadu_epi8(mask, (void*)(data + i));
+		_mm512_mask_storeu_epi8((void*)(data + i), mask, _mm512_subs_epu8(a, decrement));
+	}
+}
+
+void interleavePheromonePlanes(const uint8_t* red, const uint8_t* green, const uint8_t* blue, uint8_t* rgba, size_t numberOfCells)
+{
+	// Written as whole pixels so the compiler turns it into byte unpacks
+	uint32_t* pixels = (uint32_t*)rgba;
+
+	for(size_t i = 0; i < numberOfCells; i++)
+		pixels[i] = (uint32_t)red[i] | ((uint32_t)green[i] << 8) | ((uint32_t)blue[i] << 16) | 0xff000000u;
+}
+
+SimdLevel detectSimdLevel()
+{
+	static SimdLevel simdLevel = []
+	{
+		__builtin_cpu_init();
+		if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) return SIMD_AVX512;
+		if(__builtin_cpu_supports("avx2")) return SIMD_AVX2;
+		if(__builtin_cpu_supports("sse2")) return SIMD_SSE2;
+		return SIMD_SCALAR;
+	}();
+
+	return simdLevel;
+}
+
+const char* simdLevelName(SimdLevel simdLevel)
+{
+	switch(simdLevel)
+	{
+		case SIMD_SSE2: return "sse2";
+		case SIMD_AVX2: return "avx2";
+		case SIMD_AVX512: return "avx512";
+		default: return "scalar";
+	}
+}
+
+void evaporatePheromone(uint8_t* data, size_t bytes, uint32_t pattern, SimdLevel simdLevel)
+{
+	switch(simdLevel)
+	{
+		case SIMD_AVX512: evaporateAVX512(data, bytes, pattern); break;
+		case SIMD_AVX2: evaporateAVX2(data, bytes, pattern); break;
+		case SIMD_SSE2: evaporateSSE2(data, bytes, pattern); break;
+		default: evaporateScalar(data, bytes, pattern); break;
+	}
+}
+
+void evaporatePheromone(uint8_t* data, size_t bytes, uint32_t pattern)
+{
+	evaporatePheromone(data, bytes, pattern, detectSimdLevel());
+}
@@ -0,0 +1,401 @@
+#include <pheromoneMatrix.h>
+#include <cstdlib>
+#include <cstring>
+
+PheromoneMatrix::PheromoneMatrix(int newWidth, int newHeight, PheromoneLayout newLayout, EvaporationMode newEvaporationMode)
+{
+	layout = newLayout;
+	evaporationMode = newEvaporationMode;
+	width = newWidth;
+	height = newHeight;
+	numberOfCells = (size_t)width * height;
+
+	tilesX = (width + PHEROMONE_TILE_SIZE - 1) >> PHEROMONE_TILE_SHIFT;
+	tilesY = (height + PHEROMONE_TILE_SIZE - 1) >> PHEROMONE_TILE_SHIFT;
+	tiles = NULL;
+	tilePeak = NULL;
+
+	if(layout == TILED)
+	{
+		// Only the tile table grows with the world, tiles come with the first deposit
+		tiles = (uint8_t**)calloc((size_t)tilesX * tilesY, sizeof(uint8_t*));
+		tilePeak = (uint8_t*)calloc((size_t)tilesX * tilesY, sizeof(uint8_t));
+		evaporationMode = EAGER_EVAPORATION;
+
+		dataSize = 0;
+		data = NULL;
+		pixelStride = 4;
+	}
+	else if(layout == PLANAR)
+	{
+		// Each plane starts on its own cache line
+		size_t planeSize = (numberOfCells + 63) & ~(size_t)63;
+
+		dataSize = planeSize * PHEROMONE_CHANNELS;
+		data = (uint8_t*)aligned_alloc(64, dataSize);
+		pixelStride = 1;
+	}
+	else
+	{
+		dataSize = numberOfCells * 4;
+		data = (uint8_t*)aligned_alloc(64, (dataSize + 63) & ~(size_t)63);
+		pixelStride = 4;
+	}
+	mappedData = false;
+	pointChannels();
+
+	for(int c = 0; c < PHEROMONE_CHANNELS; c++) summedArea[c] = NULL;
+	summedAreaReady = false;
+
+	blocksX = (width + LAZY_BLOCK_SIZE - 1) >> LAZY_BLOCK_SHIFT;
+	blocksY = (height + LAZY_BLOCK_SIZE - 1) >> LAZY_BLOCK_SHIFT;
+	blockStep = NULL;
+	blockActive = NULL;
+
+	if(evaporationMode == LAZY_EVAPORATION)
+	{
+		blockStep = (uint32_t*)malloc(sizeof(uint32_t) * blocksX * blocksY);
+		blockActive = (uint8_t*)malloc(sizeof(uint8_t) * blocksX * blocksY);
+	}
+
+	clear();
+}
+
+PheromoneMatrix::~PheromoneMatrix()
+{
+	if(layout == TILED)
+	{
+		for(int tile : activeTiles) free(tiles[tile]);
+		free(tiles);
+		free(tilePeak);
+	}
+	if(!mappedData) free(data);
+	free(blockStep);
+	free(blockActive);
+	for(int c = 0; c < PHEROMONE_CHANNELS; c++) free(summedArea[c]);
+}
+
+void PheromoneMatrix::pointChannels()
+{
+	size_t planeSize = (numberOfCells + 63) & ~(size_t)63;
+
+	for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+	{
+		if(data == NULL) channels[c] = NULL;
+		else if(layout == PLANAR) channels[c] = data + c * planeSize;
+		else channels[c] = data + c;
+	}
+}
+
+void PheromoneMatrix::adoptMappedData(uint8_t* mapped)
+{
+	if(!mappedData) free(data);
+	data = mapped;
+	mappedData = true;
+	pointChannels();
+	invalidateSummedArea();
+}
+
+void PheromoneMatrix::clear()
+{
+	if(layout == TILED)
+	{
+		for(int tile : activeTiles)
+		{
+			free(tiles[tile]);
+			tiles[tile] = NULL;
+			tilePeak[tile] = 0;
+			releasedTiles.push_back(tile);
+		}
+		activeTiles.clear();
+	}
+	else if(layout == PLANAR)
+	{
+		memset(data, 0, dataSize);
+	}
+	else
+	{
+		uint32_t* pixels = (uint32_t*)data;
+		for(size_t i = 0; i < numberOfCells; i++) pixels[i] = 0xff000000u; // A = 255
+	}
+
+	evaporationSteps = 0;
+	if(evaporationMode == LAZY_EVAPORATION)
+	{
+		memset(blockStep, 0, sizeof(uint32_t) * blocksX * blocksY);
+		memset(blockActive, 0, sizeof(uint8_t) * blocksX * blocksY);
+	}
+}
+
+void PheromoneMatrix::evaporate(ThreadPool* threadPool)
+{
+	if(evaporationMode == LAZY_EVAPORATION)
+	{
+		evaporationSteps++;
+		return;
+	}
+
+	if(layout == TILED)
+	{
+		threadPool->parallelFor(0, activeTiles.size(), PHEROMONE_TILE_CHUNK, [&](int begin, int end, int threadIndex)
+		{
+			for(int i = begin; i < end; i++)
+			{
+				int tile = activeTiles[i];
+				evaporatePheromone(tiles[tile], PHEROMONE_TILE_BYTES, EVAPORATION_PATTERN_RGBA);
+				// Every value went down by one, so did the highest
+				if(tilePeak[tile] > 0) tilePeak[tile]--;
+			}
+		});
+
+		// Tiles that reached zero go back to the allocator
+		size_t kept = 0;
+		for(size_t i = 0; i < activeTiles.size(); i++)
+		{
+			int tile = activeTiles[i];
+			if(tilePeak[tile] == 0)
+			{
+				free(tiles[tile]);
+				tiles[tile] = NULL;
+				releasedTiles.push_back(tile);
+			}
+			else
+			{
+				activeTiles[kept++] = tile;
+			}
+		}
+		activeTiles.resize(kept);
+		return;
+	}
+
+	threadPool->parallelFor(0, height, PHEROMONE_ROW_CHUNK, [&](int begin, int end, int threadIndex)
+	{
+		size_t firstCell = (size_t)begin * width;
+		size_t cells = (size_t)(end - begin) * width;
+
+		if(layout == PLANAR)
+		{
+			for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+				evaporatePheromone(channels[c] + firstCell, cells, EVAPORATION_PATTERN_PLANAR);
+		}
+		else
+		{
+			evaporatePheromone(data + firstCell * 4, cells * 4, EVAPORATION_PATTERN_RGBA);
+		}
+	});
+}
+
+void PheromoneMatrix::allocateTile(int tile)
+{
+	uint32_t* pixels = (uint32_t*)aligned_alloc(64, PHEROMONE_TILE_BYTES);
+	for(int i = 0; i < PHEROMONE_TILE_SIZE * PHEROMONE_TILE_SIZE; i++) pixels[i] = 0xff000000u; // A = 255
+
+	tiles[tile] = (uint8_t*)pixels;
+	tilePeak[tile] = 0;
+	activeTiles.push_back(tile);
+}
+
+void PheromoneMatrix::settleBlock(size_t block)
+{
+	uint32_t pending = evaporationSteps - blockStep[block];
+	blockStep[block] = evaporationSteps;
+
+	// Blocks nobody deposited on since they reached zero only need the stamp
+	if(!blockActive[block] || pending == 0) return;
+
+	int decrement = (int)std::min(pending, 255u);
+	int firstX = (int)(block % blocksX) << LAZY_BLOCK_SHIFT;
+	int firstY = (int)(block / blocksX) << LAZY_BLOCK_SHIFT;
+	int lastX = std::min(firstX + LAZY_BLOCK_SIZE, width);
+	int lastY = std::min(firstY + LAZY_BLOCK_SIZE, height);
+	int remaining = 0;
+
+	for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+	{
+		for(int y = firstY; y < lastY; y++)
+		{
+			uint8_t* row = cell(c, (size_t)y * width);
+			for(int x = firstX; x < lastX; x++)
+			{
+				uint8_t* value = row + x * pixelStride;
+				*value = *value > decrement ? *value - decrement : 0;
+				remaining |= *value;
+			}
+		}
+	}
+
+	if(remaining == 0) blockActive[block] = 0;
+}
+
+void PheromoneMatrix::settle(ThreadPool* threadPool)
+{
+	if(evaporationMode != LAZY_EVAPORATION) return;
+
+	// Block rows never share a cell, so they are settled in parallel
+	threadPool->parallelFor(0, blocksY, 1, [&](int begin, int end, int threadIndex)
+	{
+		for(size_t block = (size_t)begin * blocksX; block < (size_t)end * blocksX; block++)
+			if(blockStep[block] != evaporationSteps) settleBlock(block);
+	});
+}
+
+template <int STRIDE>
+void PheromoneMatrix::buildSummedAreaRows(int begin, int end)
+{
+	size_t tableWidth = (size_t)width + 1;
+
+	for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+	{
+		for(int y = begin; y < end; y++)
+		{
+			const uint8_t* row = channels[c] + (size_t)y * width * STRIDE;
+			uint32_t* tableRow = summedArea[c] + (size_t)(y + 1) * tableWidth;
+			uint32_t prefix = 0;
+
+			tableRow[0] = 0;
+			for(int x = 0; x < width; x++)
+			{
+				prefix += row[x * STRIDE];
+				tableRow[x + 1] = prefix;
+			}
+		}
+	}
+}
+
+void PheromoneMatrix::buildSummedArea(ThreadPool* threadPool)
+{
+	size_t tableWidth = (size_t)width + 1;
+	size_t tableSize = tableWidth * (height + 1);
+
+	if(layout == TILED) return;
+
+	// The tables are built from the plain field
+	settle(threadPool);
+
+	if(summedArea[0] == NULL)
+	{
+		for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+		{
+			summedArea[c] = (uint32_t*)aligned_alloc(64, (tableSize * sizeof(uint32_t) + 63) & ~(size_t)63);
+			memset(summedArea[c], 0, tableWidth * sizeof(uint32_t));
+		}
+	}
+
+	// Prefix sum of every row, rows are independent
+	threadPool->parallelFor(0, height, PHEROMONE_ROW_CHUNK, [&](int begin, int end, int threadIndex)
+	{
+		if(pixelStride == 4) buildSummedAreaRows<4>(begin, end);
+		else buildSummedAreaRows<1>(begin, end);
+	});
+
+	// Running sum down the columns, each thread owns a band of columns and walks
+	// it row by row so the accesses stay contiguous
+	threadPool->parallelFor(1, width + 1, SUMMED_AREA_COLUMN_CHUNK, [&](int begin, int end, int threadIndex)
+	{
+		for(int c = 0; c < PHEROMONE_CHANNELS; c++)
+		{
+			for(int y = 2; y <= height; y++)
+			{
+				uint32_t* above = summedArea[c] + (size_t)(y - 1) * tableWidth;
+				uint32_t* row = summedArea[c] + (size_t)y * tableWidth;
+
+				for(int x = begin; x < end; x++) row[x] += above[x];
+			}
+		}
+	});
+
+	summedAreaReady = true;
+}
+
+void PheromoneMatrix::invalidateSummedArea()
+{
+	summedAreaReady = false;
+}
+
+void PheromoneMatrix::exportRGBA(uint8_t* rgba)
+{
+	if(layout == TILED)
+	{
+		uint32_t* pixels = (uint32_t*)rgba;
+		for(size_t i = 0; i < numberOfCells; i++) pixels[i] = 0xff000000u;
+
+		for(int tile : activeTiles) exportTileRGBA(tile, rgba);
+	}
+	else if(layout == PLANAR)
+		interleavePheromonePlanes(channels[RED], channels[GREEN], channels[BLUE], rgba, numberOfCells);
+	else
+		memcpy(rgba, data, numberOfCells * 4);
+}
+
+void PheromoneMatrix::exportTileRGBA(int tile, uint8_t* rgba)
+{
+	int firstX = (tile % tilesX) << PHEROMONE_TILE_SHIFT;
+	int firstY = (tile / tilesX) << PHEROMONE_TILE_SHIFT;
+	int columns = std::min(PHEROMONE_TILE_SIZE, width - firstX);
+	int rows = std::min(PHEROMONE_TILE_SIZE, height - firstY);
+
+	for(int y = 0; y < rows; y++)
+	{
+		size_t row = (size_t)(firstY + y) * width + firstX;
+
+		if(layout == TILED && tiles[tile] == NULL)
+			for(int x = 0; x < columns; x++) ((uint32_t*)rgba)[row + x] = 0xff000000u;
+		else if(layout == TILED)
+			memcpy(rgba + row * 4, tiles[tile] + (size_t)y * PHEROMONE_TILE_SIZE * 4, columns * 4);
+		else if(layout == PLANAR)
+			interleavePheromonePlanes(channels[RED] + row, channels[GREEN] + row, channels[BLUE] + row, rgba + row * 4, columns);
+		else
+			memcpy(rgba + row * 4, data + row * 4, columns * 4);
+	}
+}
+
+bool PheromoneMatrix::occupiedTiles(std::vector<int>& occupied)
+{
+	if(layout == TILED)
+	{
+		occupied.insert(occupied.end(), activeTiles.begin(), activeTiles.end());
+		return true;
+	}
+	if(evaporationMode != LAZY_EVAPORATION) return false;
+
+	// A tile is occupied when any of its lazy blocks is active
+	const int blocksPerTile = 1 << (PHEROMONE_TILE_SHIFT - LAZY_BLOCK_SHIFT);
+	for(int tile = 0; tile < tilesX * tilesY; tile++)
+	{
+		int firstX = (tile % tilesX) * blocksPerTile;
+		int firstY = (tile / tilesX) * blocksPerTile;
+		int lastX = std::min(firstX + blocksPerTile, blocksX);
+		int lastY = std::min(firstY + blocksPerTile, blocksY);
+		bool active = false;
+
+		for(int y = firstY; y < lastY && !active; y++)
+			for(int x = firstX; x < lastX; x++) active |= blockActive[(size_t)y * blocksX + x] != 0;
+		if(active) occupied.push_back(tile);
+	}
+	return true;
+}
+
+uint64_t PheromoneMatrix::total(int channel, ThreadPool* threadPool)
+{
+	uint64_t sum = 0;
+
+	if(layout == TILED)
+	{
+		for(int tile : activeTiles)
+			for(int i = 0; i < PHEROMONE_TILE_SIZE * PHEROMONE_TILE_SIZE; i++) sum += tiles[tile][i * 4 + channel];
+	}
+	else
+	{
+		settle(threadPool);
+		for(size_t i = 0; i < numberOfCells; i++) sum += *cell(channel, i);
+	}
+
+	return sum;
+}
+
+size_t PheromoneMatrix::memoryUsage()
+{
+	if(layout == TILED)
+		return activeTiles.size() * PHEROMONE_TILE_BYTES + (size_t)tilesX * tilesY * (sizeof(uint8_t*) + sizeof(uint8_t));
+	return dataSize;
+}
@@ -0,0 +1,364 @@
+#include <pheromoneRecorder.h>
+#include <trace.h>
+#include <varint.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+
+// Appends the runs of one tile of field against reference, NULL for the empty
+// field. Returns false and appends nothing when the tile equals its reference.
+static bool encodeTile(const uint32_t* field, const uint32_t* reference, int width, int firstX, int firstY, int columns, int rows, vector<uint8_t>& payload)
+{
+	uint32_t difference[PHEROMONE_TILE_SIZE * PHEROMONE_TILE_SIZE];
+	uint32_t changed = 0;
+	int pixels = columns * rows;
+
+	for(int y = 0; y < rows; y++)
+	{
+		size_t row = (size_t)(firstY + y) * width + firstX;
+		for(int x = 0; x < columns; x++)
+		{
+			uint32_t value = field[row + x] ^ (reference != NULL ? reference[row + x] : EMPTY_PHEROMONE_PIXEL);
+			difference[y * columns + x] = value;
+			changed |= value;
+		}
+	}
+	if(changed == 0) return false;
+
+	for(int i = 0; i < pixels;)
+	{
+		int zeros = i;
+		while(i < pixels && difference[i] == 0) i++;
+		int literals = i;
+		while(i < pixels && difference[i] != 0) i++;
+
+		putVarint(payload, literals - zeros);
+		putVarint(payload, i - literals);
+		const uint8_t* bytes = (const uint8_t*)(difference + literals);
+		payload.insert(payload.end(), bytes, bytes + (size_t)(i - literals) * sizeof(uint32_t));
+	}
+	return true;
+}
+
+PheromoneRecorder::PheromoneRecorder(const char* path, int width, int height, int newInterval, int keyframeInterval)
+{
+	interval = max(newInterval, 1);
+	framesRecorded = 0;
+	framesDropped = 0;
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, PHEROMONE_SERIES_MAGIC, sizeof(header.magic));
+	header.version = PHEROMONE_SERIES_VERSION;
+	header.width = width;
+	header.height = height;
+	header.tileSize = PHEROMONE_TILE_SIZE;
+	header.interval = interval;
+	header.keyframeInterval = max(keyframeInterval, 1);
+
+	frameBytes = (size_t)width * height * 4;
+	tilesX = (width + PHEROMONE_TILE_SIZE - 1) / PHEROMONE_TILE_SIZE;
+	tilesY = (height + PHEROMONE_TILE_SIZE - 1) / PHEROMONE_TILE_SIZE;
+
+	for(int s = 0; s < PHEROMONE_RING_FRAMES; s++)
+	{
+		slots[s] = NULL;
+		slotTicks[s] = 0;
+		slotByTiles[s] = false;
+	}
+	keyframe = NULL;
+	keyframeEntry = -1;
+	head.store(0);
+	tail.store(0);
+	stopping.store(false);
+
+	file = fopen(path, "wb");
+	if(file == NULL || fwrite(&header, sizeof(header), 1, file) != 1)
+	{
+		fprintf(stderr, "could not write the pheromone series to %s\n", path);
+		if(file != NULL) fclose(file);
+		file = NULL;
+		return;
+	}
+
+	for(int s = 0; s < PHEROMONE_RING_FRAMES; s++) slots[s] = (uint8_t*)malloc(frameBytes);
+	keyframe = (uint8_t*)malloc(frameBytes);
+	tileMarks.assign((size_t)tilesX * tilesY, 0);
+
+	writer = thread(&PheromoneRecorder::writerLoop, this);
+}
+
+PheromoneRecorder::~PheromoneRecorder()
+{
+	close();
+	for(int s = 0; s < PHEROMONE_RING_FRAMES; s++) free(slots[s]);
+	free(keyframe);
+}
+
+bool PheromoneRecorder::isOpen()
+{
+	return file != NULL;
+}
+
+void PheromoneRecorder::record(PheromoneMatrix* pheromoneMatrix, ThreadPool* threadPool, uint64_t tick)
+{
+	if(file == NULL || tick % interval != 0) return;
+
+	TRACE_SCOPE("PheromoneRecorder::record");
+
+	uint64_t position = head.load(memory_order_relaxed);
+	if(position - tail.load(memory_order_acquire) == PHEROMONE_RING_FRAMES)
+	{
+		framesDropped++;
+		return;
+	}
+
+	// The slot is free, the writer does not touch it until head moves past it
+	int s = position % PHEROMONE_RING_FRAMES;
+	pheromoneMatrix->settle(threadPool);
+
+	occupied.clear();
+	bool byTiles = pheromoneMatrix->occupiedTiles(occupied);
+	if(byTiles && slotByTiles[s])
+	{
+		// Tiles empty now and in the frame of the slot already match
+		for(int tile : occupied) tileMarks[tile] = 1;
+		for(int tile : slotTiles[s]) if(!tileMarks[tile]) clearTile(slots[s], tile);
+		for(int tile : occupied)
+		{
+			tileMarks[tile] = 0;
+			pheromoneMatrix->exportTileRGBA(tile, slots[s]);
+		}
+	}
+	else pheromoneMatrix->exportRGBA(slots[s]);
+
+	slotByTiles[s] = byTiles;
+	slotTiles[s].swap(occupied);
+	slotTicks[s] = tick;
+
+	head.store(position + 1, memory_order_release);
+	wake.notify_one();
+	framesRecorded++;
+}
+
+void PheromoneRecorder::clearTile(uint8_t* field, int tile)
+{
+	int firstX = (tile % tilesX) * PHEROMONE_TILE_SIZE;
+	int firstY = (tile / tilesX) * PHEROMONE_TILE_SIZE;
+	int columns = min(PHEROMONE_TILE_SIZE, header.width - firstX);
+	int rows = min(PHEROMONE_TILE_SIZE, header.height - firstY);
+
+	for(int y = 0; y < rows; y++)
+	{
+		uint32_t* row = (uint32_t*)field + (size_t)(firstY + y) * header.width + firstX;
+		for(int x = 0; x < columns; x++) row[x] = EMPTY_PHEROMONE_PIXEL;
+	}
+}
+
+void PheromoneRecorder::close()
+{
+	if(file == NULL) return;
+
+	stopping.store(true, memory_order_release);
+	wake.notify_one();
+	writer.join();
+
+	PheromoneSeriesFooter footer;
+	footer.indexOffset = ftello(file);
+	footer.numberOfFrames = index.size();
+	memcpy(footer.magic, PHEROMONE_SERIES_MAGIC, sizeof(footer.magic));
+
+	if(!index.empty()) fwrite(index.data(), sizeof(PheromoneIndexEntry), index.size(), file);
+	fwrite(&footer, sizeof(footer), 1, file);
+	fclose(file);
+	file = NULL;
+}
+
+void PheromoneRecorder::writerLoop()
+{
+	while(true)
+	{
+		uint64_t position = tail.load(memory_order_relaxed);
+
+		if(position == head.load(memory_order_acquire))
+		{
+			// The last frame is in the ring before stopping is set
+			if(stopping.load(memory_order_acquire) && position == head.load(memory_order_acquire)) break;
+
+			// A notify missed between the check and the wait costs at most the timeout
+			unique_lock<mutex> lock(wakeMutex);
+			wake.wait_for(lock, chrono::milliseconds(5));
+			continue;
+		}
+
+		writeFrame(slots[position % PHEROMONE_RING_FRAMES], slotTicks[position % PHEROMONE_RING_FRAMES]);
+		tail.store(position + 1, memory_order_release);
+	}
+}
+
+void PheromoneRecorder::writeFrame(const uint8_t* field, uint64_t tick)
+{
+	TRACE_SCOPE("PheromoneRecorder::writeFrame");
+
+	bool isKeyframe = index.size() % header.keyframeInterval == 0;
+	const uint32_t* reference = isKeyframe ? NULL : (const uint32_t*)keyframe;
+
+	PheromoneFrameHeader frameHeader;
+	frameHeader.tick = tick;
+	frameHeader.keyframe = isKeyframe;
+	frameHeader.changedTiles = 0;
+
+	payload.clear();
+	int previousTile = -1;
+	for(int tile = 0; tile < tilesX * tilesY; tile++)
+	{
+		int firstX = (tile % tilesX) * PHEROMONE_TILE_SIZE;
+		int firstY = (tile / tilesX) * PHEROMONE_TILE_SIZE;
+		int columns = min(PHEROMONE_TILE_SIZE, header.width - firstX);
+		int rows = min(PHEROMONE_TILE_SIZE, header.height - firstY);
+
+		size_t mark = payload.size();
+		putVarint(payload, tile - previousTile - 1);
+		if(encodeTile((const uint32_t*)field, reference, header.width, firstX, firstY, columns, rows, payload))
+		{
+			frameHeader.changedTiles++;
+			previousTile = tile;
+		}
+		else payload.resize(mark);
+	}
+	frameHeader.payloadBytes = payload.size();
+
+	if(isKeyframe)
+	{
+		memcpy(keyframe, field, frameBytes);
+		keyframeEntry = index.size();
+	}
+	index.push_back({tick, (uint64_t)ftello(file), keyframeEntry});
+
+	fwrite(&frameHeader, sizeof(frameHeader), 1, file);
+	if(!payload.empty()) fwrite(payload.data(), 1, payload.size(), file);
+}
+
+PheromoneReader::PheromoneReader()
+{
+	file = NULL;
+	keyframeEntry = -1;
+}
+
+PheromoneReader::~PheromoneReader()
+{
+	if(file != NULL) fclose(file);
+}
+
+bool PheromoneReader::open(const char* path)
+{
+	if(file != NULL) fclose(file);
+	index.clear();
+	keyframeEntry = -1;
+
+	file = fopen(path, "rb");
+	if(file == NULL) return false;
+
+	PheromoneSeriesFooter footer;
+	bool valid = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, PHEROMONE_SERIES_MAGIC, sizeof(header.magic)) == 0;
+	valid = valid && header.version == PHEROMONE_SERIES_VERSION && header.tileSize == PHEROMONE_TILE_SIZE && header.width > 0 && header.height > 0;
+	valid = valid && fseeko(file, -(off_t)sizeof(footer), SEEK_END) == 0 && fread(&footer, sizeof(footer), 1, file) == 1;
+	valid = valid && memcmp(footer.magic, PHEROMONE_SERIES_MAGIC, sizeof(footer.magic)) == 0;
+
+	if(valid)
+	{
+		index.resize(footer.numberOfFrames);
+		valid = fseeko(file, footer.indexOffset, SEEK_SET) == 0 && (index.empty() || fread(index.data(), sizeof(PheromoneIndexEntry), index.size(), file) == index.size());
+	}
+
+	if(!valid)
+	{
+		fprintf(stderr, "%s is not a complete pheromone series\n", path);
+		fclose(file);
+		file = NULL;
+		index.clear();
+	}
+	return valid;
+}
+
+size_t PheromoneReader::frameBytes()
+{
+	return (size_t)header.width * header.height * 4;
+}
+
+int PheromoneReader::findFrame(uint64_t tick)
+{
+	int frame = upper_bound(index.begin(), index.end(), tick, [](uint64_t value, const PheromoneIndexEntry& entry) { return value < entry.tick; }) - index.begin();
+	return index.empty() ? -1 : max(frame - 1, 0);
+}
+
+bool PheromoneReader::readFrame(int frame, uint8_t* rgba)
+{
+	if(file == NULL || frame < 0 || frame >= (int)index.size()) return false;
+
+	TRACE_SCOPE("PheromoneReader::readFrame");
+
+	int64_t key = index[frame].keyframe;
+	if(key < 0 || key > frame) return false;
+
+	if(key != keyframeEntry)
+	{
+		keyframe.resize(frameBytes());
+		uint32_t* pixels = (uint32_t*)keyframe.data();
+		for(size_t i = 0; i < (size_t)header.width * header.height; i++) pixels[i] = EMPTY_PHEROMONE_PIXEL;
+
+		keyframeEntry = -1;
+		if(!applyRecord(key, keyframe.data())) return false;
+		keyframeEntry = key;
+	}
+
+	memcpy(rgba, keyframe.data(), frameBytes());
+	return frame == key || applyRecord(frame, rgba);
+}
+
+bool PheromoneReader::applyRecord(int64_t entry, uint8_t* rgba)
+{
+	PheromoneFrameHeader frameHeader;
+	if(fseeko(file, index[entry].offset, SEEK_SET) != 0 || fread(&frameHeader, sizeof(frameHeader), 1, file) != 1) return false;
+
+	payload.resize(frameHeader.payloadBytes);
+	if(!payload.empty() && fread(payload.data(), 1, payload.size(), file) != payload.size()) return false;
+
+	int tilesX = (header.width + PHEROMONE_TILE_SIZE - 1) / PHEROMONE_TILE_SIZE;
+	int tilesY = (header.height + PHEROMONE_TILE_SIZE - 1) / PHEROMONE_TILE_SIZE;
+	uint32_t* pixels = (uint32_t*)rgba;
+	const uint8_t* cursor = payload.data();
+	const uint8_t* end = cursor + payload.size();
+	int64_t tile = -1;
+
+	for(int t = 0; t < frameHeader.changedTiles; t++)
+	{
+		uint64_t gap;
+		if(!getVarint(cursor, end, gap)) return false;
+		tile += gap + 1;
+		if(tile >= (int64_t)tilesX * tilesY) return false;
+
+		int firstX = (tile % tilesX) * PHEROMONE_TILE_SIZE;
+		int firstY = (tile / tilesX) * PHEROMONE_TILE_SIZE;
+		int columns = min(PHEROMONE_TILE_SIZE, header.width - firstX);
+		int pixelsInTile = columns * min(PHEROMONE_TILE_SIZE, header.height - firstY);
+
+		for(int i = 0; i < pixelsInTile;)
+		{
+			uint64_t zeros, literals;
+			if(!getVarint(cursor, end, zeros) || !getVarint(cursor, end, literals)) return false;
+			if(zeros + literals == 0 || zeros + literals > (uint64_t)(pixelsInTile - i) || literals * sizeof(uint32_t) > (uint64_t)(end - cursor)) return false;
+
+			i += zeros;
+			for(uint64_t k = 0; k < literals; k++, i++)
+			{
+				uint32_t difference;
+				memcpy(&difference, cursor, sizeof(difference));
+				cursor += sizeof(difference);
+				pixels[(size_t)(firstY + i / columns) * header.width + firstX + i % columns] ^= difference;
+			}
+		}
+	}
+
+	return cursor == end;
+}
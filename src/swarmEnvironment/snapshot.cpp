@@ -0,0 +1,296 @@
+#include <environment.h>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static inline uint64_t alignSnapshotOffset(uint64_t offset)
+{
+	return (offset + SNAPSHOT_ALIGNMENT - 1) & ~(uint64_t)(SNAPSHOT_ALIGNMENT - 1);
+}
+
+bool Environment::saveSnapshot(const char* path)
+{
+	TRACE_SCOPE("Environment::saveSnapshot");
+
+	SnapshotHeader header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+	header.version = SNAPSHOT_VERSION;
+	header.headerBytes = sizeof(SnapshotHeader);
+	header.width = pheromoneMatrix->width;
+	header.height = pheromoneMatrix->height;
+	header.layout = pheromoneMatrix->layout;
+	header.evaporationMode = pheromoneMatrix->evaporationMode;
+	header.antStorage = ants.storage;
+	header.globalSeed = ants.seed;
+	header.tick = tick;
+	header.evaporationSteps = pheromoneMatrix->evaporationSteps;
+	header.numberOfAnts = numberOfAnts;
+	header.numberOfNests = nests.size();
+	header.numberOfFoods = foods.size();
+	header.numberOfSpecies = ants.allSpecies.size();
+	header.numberOfActiveTiles = pheromoneMatrix->activeTiles.size();
+
+	// Small records are gathered first, the large arrays are written from where they are
+	vector<SnapshotSpecies> species(ants.allSpecies.size());
+	for(size_t s = 0; s < species.size(); s++)
+	{
+		vector<AntParameters*>& antParameters = parameterAssigner->antParameters;
+		species[s].antParametersIndex = find(antParameters.begin(), antParameters.end(), ants.allSpecies[s].antParameters) - antParameters.begin();
+		if(species[s].antParametersIndex == (int32_t)antParameters.size()) species[s].antParametersIndex = -1;
+		species[s].species = ants.allSpecies[s];
+		species[s].species.antParameters = NULL;
+	}
+
+	vector<SnapshotLandmark> nestRecords, foodRecords;
+	for(Anthill* nest : nests) nestRecords.push_back({nest->id, nest->posX, nest->posY, nest->size, nest->antAmount});
+	for(FoodSource* food : foods) foodRecords.push_back({food->id, food->posX, food->posY, food->size, food->foodAmount});
+
+	vector<uint8_t> tilePixels;
+	vector<uint8_t> tilePeaks;
+	if(pheromoneMatrix->layout == TILED)
+	{
+		tilePixels.resize(pheromoneMatrix->activeTiles.size() * PHEROMONE_TILE_BYTES);
+		for(size_t t = 0; t < pheromoneMatrix->activeTiles.size(); t++)
+		{
+			int tile = pheromoneMatrix->activeTiles[t];
+			memcpy(tilePixels.data() + t * PHEROMONE_TILE_BYTES, pheromoneMatrix->tiles[tile], PHEROMONE_TILE_BYTES);
+			tilePeaks.push_back(pheromoneMatrix->tilePeak[tile]);
+		}
+	}
+
+	const void* sources[NUMBER_OF_SNAPSHOT_SECTIONS] = {};
+	auto section = [&](int type, const void* source, size_t bytes)
+	{
+		sources[type] = source;
+		header.sections[type].bytes = bytes;
+	};
+
+	size_t blocks = (size_t)pheromoneMatrix->blocksX * pheromoneMatrix->blocksY;
+	if(pheromoneMatrix->layout == TILED) section(SNAPSHOT_PHEROMONE, tilePixels.data(), tilePixels.size());
+	else section(SNAPSHOT_PHEROMONE, pheromoneMatrix->data, pheromoneMatrix->dataSize);
+	section(SNAPSHOT_TILE_INDICES, pheromoneMatrix->activeTiles.data(), pheromoneMatrix->activeTiles.size() * sizeof(int));
+	section(SNAPSHOT_TILE_PEAKS, tilePeaks.data(), tilePeaks.size());
+	if(pheromoneMatrix->evaporationMode == LAZY_EVAPORATION)
+	{
+		section(SNAPSHOT_BLOCK_STEPS, pheromoneMatrix->blockStep, blocks * sizeof(uint32_t));
+		section(SNAPSHOT_BLOCK_ACTIVE, pheromoneMatrix->blockActive, blocks);
+	}
+	section(SNAPSHOT_SPECIES, species.data(), species.size() * sizeof(SnapshotSpecies));
+	section(SNAPSHOT_NESTS, nestRecords.data(), nestRecords.size() * sizeof(SnapshotLandmark));
+	section(SNAPSHOT_FOODS, foodRecords.data(), foodRecords.size() * sizeof(SnapshotLandmark));
+
+	int k = 0;
+	ants.forEachArray([&](auto*& array)
+	{
+		section(SNAPSHOT_ANT_ARRAYS + k, array, (size_t)numberOfAnts * sizeof(*array));
+		k++;
+	});
+
+	// Every section starts on a page and the file ends on one, so the last
+	// array can be read past its end like the heap arrays
+	uint64_t offset = alignSnapshotOffset(sizeof(SnapshotHeader));
+	for(int s = 0; s < NUMBER_OF_SNAPSHOT_SECTIONS; s++)
+	{
+		header.sections[s].offset = offset;
+		offset = alignSnapshotOffset(offset + header.sections[s].bytes);
+	}
+	uint64_t fileBytes = offset;
+
+	string temporaryPath = string(path) + ".tmp";
+	FILE* file = fopen(temporaryPath.c_str(), "wb");
+	if(file == NULL)
+	{
+		fprintf(stderr, "could not write the snapshot to %s\n", temporaryPath.c_str());
+		return false;
+	}
+
+	bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+	for(int s = 0; s < NUMBER_OF_SNAPSHOT_SECTIONS && written; s++)
+	{
+		if(header.sections[s].bytes == 0) continue;
+		written = fseeko(file, header.sections[s].offset, SEEK_SET) == 0;
+		written = written && fwrite(sources[s], header.sections[s].bytes, 1, file) == 1;
+	}
+	written = written && fflush(file) == 0 && ftruncate(fileno(file), fileBytes) == 0;
+	written = (fclose(file) == 0) && written;
+
+	// Replacing the file keeps a mapping of the previous snapshot at that path intact
+	if(!written || rename(temporaryPath.c_str(), path) != 0)
+	{
+		fprintf(stderr, "could not write the snapshot to %s\n", path);
+		remove(temporaryPath.c_str());
+		return false;
+	}
+
+	return true;
+}
+
+bool Environment::loadSnapshot(const char* path)
+{
+	TRACE_SCOPE("Environment::loadSnapshot");
+
+	int descriptor = open(path, O_RDONLY);
+	struct stat status;
+	if(descriptor < 0 || fstat(descriptor, &status) != 0 || (size_t)status.st_size < sizeof(SnapshotHeader))
+	{
+		fprintf(stderr, "could not read the snapshot %s\n", path);
+		if(descriptor >= 0) close(descriptor);
+		return false;
+	}
+
+	size_t mappingBytes = status.st_size;
+	void* mapping = mmap(NULL, mappingBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE, descriptor, 0);
+	close(descriptor);
+	if(mapping == MAP_FAILED)
+	{
+		fprintf(stderr, "could not map the snapshot %s\n", path);
+		return false;
+	}
+
+	uint8_t* base = (uint8_t*)mapping;
+	SnapshotHeader* header = (SnapshotHeader*)base;
+
+	// Everything is checked before the environment is touched
+	const char* problem = NULL;
+	if(memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0) problem = "not a snapshot";
+	else if(header->version != SNAPSHOT_VERSION || header->headerBytes != sizeof(SnapshotHeader)) problem = "snapshot of another version";
+	else if(header->width != pheromoneMatrix->width || header->height != pheromoneMatrix->height) problem = "snapshot of another world size";
+	else if(header->layout != pheromoneMatrix->layout || header->evaporationMode != pheromoneMatrix->evaporationMode) problem = "snapshot of another pheromone layout";
+	else if(header->antStorage != ants.storage) problem = "snapshot of another ant storage";
+	else if(header->numberOfAnts < 0 || header->numberOfNests < 0 || header->numberOfFoods < 0 || header->numberOfSpecies < 0 || header->numberOfActiveTiles < 0) problem = "corrupt snapshot";
+
+	for(int s = 0; s < NUMBER_OF_SNAPSHOT_SECTIONS && problem == NULL; s++)
+	{
+		SnapshotSection& section = header->sections[s];
+		if(section.offset % SNAPSHOT_ALIGNMENT != 0 || section.offset > mappingBytes || section.bytes > mappingBytes - section.offset) problem = "truncated snapshot";
+	}
+
+	auto expect = [&](int type, uint64_t bytes)
+	{
+		if(problem == NULL && header->sections[type].bytes != bytes) problem = "corrupt snapshot";
+	};
+
+	size_t blocks = (size_t)pheromoneMatrix->blocksX * pheromoneMatrix->blocksY;
+	if(pheromoneMatrix->layout == TILED) expect(SNAPSHOT_PHEROMONE, (uint64_t)header->numberOfActiveTiles * PHEROMONE_TILE_BYTES);
+	else expect(SNAPSHOT_PHEROMONE, pheromoneMatrix->dataSize);
+	expect(SNAPSHOT_TILE_INDICES, (uint64_t)header->numberOfActiveTiles * sizeof(int));
+	expect(SNAPSHOT_TILE_PEAKS, header->numberOfActiveTiles);
+	expect(SNAPSHOT_BLOCK_STEPS, pheromoneMatrix->evaporationMode == LAZY_EVAPORATION ? blocks * sizeof(uint32_t) : 0);
+	expect(SNAPSHOT_BLOCK_ACTIVE, pheromoneMatrix->evaporationMode == LAZY_EVAPORATION ? blocks : 0);
+	expect(SNAPSHOT_SPECIES, (uint64_t)header->numberOfSpecies * sizeof(SnapshotSpecies));
+	expect(SNAPSHOT_NESTS, (uint64_t)header->numberOfNests * sizeof(SnapshotLandmark));
+	expect(SNAPSHOT_FOODS, (uint64_t)header->numberOfFoods * sizeof(SnapshotLandmark));
+
+	int k = 0;
+	ants.forEachArray([&](auto*& array)
+	{
+		expect(SNAPSHOT_ANT_ARRAYS + k, (uint64_t)header->numberOfAnts * sizeof(*array));
+		k++;
+	});
+
+	const int* tileIndices = (const int*)(base + header->sections[SNAPSHOT_TILE_INDICES].offset);
+	int numberOfTiles = pheromoneMatrix->tilesX * pheromoneMatrix->tilesY;
+	for(int t = 0; t < header->numberOfActiveTiles && problem == NULL; t++)
+		if(tileIndices[t] < 0 || tileIndices[t] >= numberOfTiles) problem = "corrupt snapshot";
+
+	const uint8_t* antSpecies = base + header->sections[SNAPSHOT_ANT_ARRAYS].offset;
+	for(int i = 0; i < header->numberOfAnts && problem == NULL; i++)
+		if(antSpecies[i] >= header->numberOfSpecies) problem = "corrupt snapshot";
+
+	if(problem != NULL)
+	{
+		fprintf(stderr, "%s: %s\n", path, problem);
+		munmap(mapping, mappingBytes);
+		return false;
+	}
+
+	// Pheromone field, the tiles are few and freed one by one, they are copied
+	if(pheromoneMatrix->layout == TILED)
+	{
+		pheromoneMatrix->clear();
+		const uint8_t* tilePixels = base + header->sections[SNAPSHOT_PHEROMONE].offset;
+		const uint8_t* tilePeaks = base + header->sections[SNAPSHOT_TILE_PEAKS].offset;
+		for(int t = 0; t < header->numberOfActiveTiles; t++)
+		{
+			pheromoneMatrix->allocateTile(tileIndices[t]);
+			memcpy(pheromoneMatrix->tiles[tileIndices[t]], tilePixels + (size_t)t * PHEROMONE_TILE_BYTES, PHEROMONE_TILE_BYTES);
+			pheromoneMatrix->tilePeak[tileIndices[t]] = tilePeaks[t];
+		}
+	}
+	else
+	{
+		pheromoneMatrix->adoptMappedData(base + header->sections[SNAPSHOT_PHEROMONE].offset);
+	}
+	pheromoneMatrix->evaporationSteps = header->evaporationSteps;
+	if(pheromoneMatrix->evaporationMode == LAZY_EVAPORATION)
+	{
+		memcpy(pheromoneMatrix->blockStep, base + header->sections[SNAPSHOT_BLOCK_STEPS].offset, blocks * sizeof(uint32_t));
+		memcpy(pheromoneMatrix->blockActive, base + header->sections[SNAPSHOT_BLOCK_ACTIVE].offset, blocks);
+	}
+
+	// Nests and food sources
+	for(Anthill* nest : nests) delete nest;
+	for(FoodSource* food : foods) delete food;
+	nests.clear();
+	foods.clear();
+	nestIndex.clear();
+	foodIndex.clear();
+
+	const SnapshotLandmark* nestRecords = (const SnapshotLandmark*)(base + header->sections[SNAPSHOT_NESTS].offset);
+	for(int n = 0; n < header->numberOfNests; n++)
+	{
+		AnthillParameters anthillParameters = {nestRecords[n].id, nestRecords[n].posX, nestRecords[n].posY, nestRecords[n].size, nestRecords[n].amount, 0};
+		nests.push_back(new Anthill(&anthillParameters));
+		nestIndex.insert(nests.back());
+	}
+
+	const SnapshotLandmark* foodRecords = (const SnapshotLandmark*)(base + header->sections[SNAPSHOT_FOODS].offset);
+	for(int f = 0; f < header->numberOfFoods; f++)
+	{
+		FoodSourceParameters foodParameters = {foodRecords[f].id, foodRecords[f].posX, foodRecords[f].posY, foodRecords[f].size, foodRecords[f].amount};
+		foods.push_back(new FoodSource(&foodParameters));
+		foodIndex.insert(foods.back());
+	}
+
+	// Ants, the species get their parameters back and the arrays stay in the mapping
+	ants.clear();
+	const SnapshotSpecies* species = (const SnapshotSpecies*)(base + header->sections[SNAPSHOT_SPECIES].offset);
+	for(int s = 0; s < header->numberOfSpecies; s++)
+	{
+		AntSpecies restored = species[s].species;
+		int index = species[s].antParametersIndex;
+		restored.antParameters = index >= 0 && index < (int)parameterAssigner->antParameters.size() ? parameterAssigner->antParameters[index] : NULL;
+		ants.allSpecies.push_back(restored);
+	}
+
+	uint8_t* arrays[SNAPSHOT_MAX_ANT_ARRAYS];
+	for(int a = 0; a < SNAPSHOT_MAX_ANT_ARRAYS; a++) arrays[a] = base + header->sections[SNAPSHOT_ANT_ARRAYS + a].offset;
+	ants.adoptMappedArrays(arrays, header->numberOfAnts);
+
+	numberOfNests = header->numberOfNests;
+	numberOfFoods = header->numberOfFoods;
+	numberOfAnts = header->numberOfAnts;
+	tick = header->tick;
+	// Every random draw is keyed on the seed and the tick
+	ants.seed = header->globalSeed;
+
+	// Nothing points into the previous mapping any more
+	releaseSnapshot();
+	snapshotMapping = mapping;
+	snapshotMappingBytes = mappingBytes;
+
+	return true;
+}
+
+void Environment::releaseSnapshot()
+{
+	if(snapshotMapping == NULL) return;
+
+	munmap(snapshotMapping, snapshotMappingBytes);
+	snapshotMapping = NULL;
+	snapshotMappingBytes = 0;
+}
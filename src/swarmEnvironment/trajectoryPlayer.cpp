@@ -0,0 +1,266 @@
+#include <trajectoryPlayer.h>
+
+#include <algorithm>
+#include <cstring>
+
+TrajectoryPlayer::TrajectoryPlayer()
+{
+	firstTick = 0;
+	lastTick = 0;
+	position = 0;
+	speed = 600;
+	playing = false;
+
+	decodePool = new ThreadPool(min(ThreadPool::defaultNumberOfThreads(), (int)TRAJECTORY_COLUMNS));
+
+	stopping = false;
+	wantedChunk = 0;
+	direction = 1;
+	shownChunk = -1;
+	shownFrame = -1;
+	hasPheromones = false;
+	shownPheromoneFrame = -1;
+}
+
+TrajectoryPlayer::~TrajectoryPlayer()
+{
+	close();
+	delete decodePool;
+}
+
+bool TrajectoryPlayer::open(const char* trajectoryPath, const char* pheromonePath)
+{
+	close();
+
+	bool hasTrajectory = trajectoryPath[0] != '\0' && reader.open(trajectoryPath);
+	if(hasTrajectory && reader.index.empty())
+	{
+		fprintf(stderr, "%s holds no frames\n", trajectoryPath);
+		hasTrajectory = false;
+	}
+	hasPheromones = pheromonePath[0] != '\0' && pheromoneReader.open(pheromonePath);
+	if(hasPheromones && pheromoneReader.index.empty())
+	{
+		fprintf(stderr, "%s holds no frames\n", pheromonePath);
+		hasPheromones = false;
+	}
+	if(!hasTrajectory && !hasPheromones) return false;
+
+	firstTick = UINT64_MAX;
+	lastTick = 0;
+	if(hasTrajectory)
+	{
+		firstTick = reader.index.front().firstTick;
+		lastTick = reader.index.back().lastTick;
+	}
+	if(hasPheromones)
+	{
+		firstTick = min(firstTick, pheromoneReader.index.front().tick);
+		lastTick = max(lastTick, pheromoneReader.index.back().tick);
+	}
+	position = firstTick;
+	shownPheromoneFrame = -1;
+
+	if(hasTrajectory)
+	{
+		stopping = false;
+		wantedChunk = 0;
+		shownChunk = -1;
+		shownFrame = -1;
+		loader = thread(&TrajectoryPlayer::loaderLoop, this);
+	}
+	return true;
+}
+
+void TrajectoryPlayer::close()
+{
+	hasPheromones = false;
+	if(!loader.joinable()) return;
+
+	{
+		lock_guard<mutex> lock(cacheMutex);
+		stopping = true;
+	}
+	wake.notify_one();
+	loader.join();
+
+	cache.clear();
+	reader.index.clear();
+}
+
+bool TrajectoryPlayer::isOpen()
+{
+	return loader.joinable() || hasPheromones;
+}
+
+void TrajectoryPlayer::advance(double seconds)
+{
+	if(!playing || !isOpen()) return;
+
+	position += speed * seconds;
+	if(position <= firstTick || position >= lastTick)
+	{
+		position = min(max(position, (double)firstTick), (double)lastTick);
+		playing = false;
+	}
+}
+
+void TrajectoryPlayer::seek(uint64_t tick)
+{
+	position = min(max(tick, firstTick), lastTick);
+}
+
+bool TrajectoryPlayer::showFrame(Environment* environment)
+{
+	TRACE_SCOPE("TrajectoryPlayer::showFrame");
+
+	if(hasPheromones) showPheromones(environment);
+	if(!loader.joinable()) return false;
+
+	uint64_t tick = (uint64_t)position;
+	int chunk = reader.findChunk(tick);
+	if(chunk < 0) chunk = reader.index.size() - 1;
+
+	shared_ptr<TrajectoryChunk> decoded;
+	{
+		lock_guard<mutex> lock(cacheMutex);
+		if(wantedChunk != chunk || direction != (speed < 0 ? -1 : 1))
+		{
+			wantedChunk = chunk;
+			direction = speed < 0 ? -1 : 1;
+			wake.notify_one();
+		}
+		for(shared_ptr<TrajectoryChunk>& cached : cache)
+			if(cached->chunk == chunk) decoded = cached;
+	}
+	if(!decoded || decoded->frames.empty()) return false;
+
+	// Ticks between two chunks show the first frame of the next one
+	vector<TrajectoryFrame>& frames = decoded->frames;
+	int frame = upper_bound(frames.begin(), frames.end(), tick, [](uint64_t value, const TrajectoryFrame& entry) { return value < entry.tick; }) - frames.begin();
+	frame = max(frame - 1, 0);
+	if(chunk == shownChunk && frame == shownFrame) return true;
+
+	AntSwarm& ants = environment->ants;
+	if(ants.storage != (AntStorage)reader.header.antStorage)
+	{
+		ants.numberOfAnts = 0;
+		ants.setStorage((AntStorage)reader.header.antStorage);
+	}
+	if(ants.allSpecies.empty()) ants.addAnt(0.0f, 0.0f, environment->parameterAssigner->antParameters[0]);
+
+	// Only the recorded arrays are written, the rest stays as it was since
+	// nothing but the renderer reads these ants
+	int numberOfAnts = frames[frame].numberOfAnts;
+	ants.reserve(numberOfAnts);
+	for(int i = ants.numberOfAnts; i < numberOfAnts; i++) ants.species[i] = 0;
+	ants.numberOfAnts = numberOfAnts;
+	environment->numberOfAnts = numberOfAnts;
+	environment->tick = frames[frame].tick;
+
+	uint8_t* targets[TRAJECTORY_COLUMNS];
+	if(ants.storage == FLOAT_ANTS)
+	{
+		targets[TRAJECTORY_POS_X] = (uint8_t*)ants.posX;
+		targets[TRAJECTORY_POS_Y] = (uint8_t*)ants.posY;
+		targets[TRAJECTORY_HEADING] = (uint8_t*)ants.theta;
+		targets[TRAJECTORY_STATE] = ants.state;
+	}
+	else
+	{
+		targets[TRAJECTORY_POS_X] = (uint8_t*)ants.fixedX;
+		targets[TRAJECTORY_POS_Y] = (uint8_t*)ants.fixedY;
+		targets[TRAJECTORY_HEADING] = (uint8_t*)ants.heading;
+		targets[TRAJECTORY_STATE] = ants.flags;
+	}
+	for(int c = 0; c < TRAJECTORY_COLUMNS; c++)
+	{
+		size_t bytes = reader.header.valueBytes[c];
+		memcpy(targets[c], decoded->columns[c].data() + decoded->frameBegin[frame] * bytes, numberOfAnts * bytes);
+	}
+
+	shownChunk = chunk;
+	shownFrame = frame;
+	return true;
+}
+
+void TrajectoryPlayer::showPheromones(Environment* environment)
+{
+	int frame = pheromoneReader.findFrame((uint64_t)position);
+	if(frame == shownPheromoneFrame) return;
+
+	// Frames decode straight into the field
+	PheromoneSeriesHeader& header = pheromoneReader.header;
+	PheromoneMatrix*& pheromoneMatrix = environment->pheromoneMatrix;
+	if(pheromoneMatrix->layout != INTERLEAVED_RGBA || pheromoneMatrix->evaporationMode != EAGER_EVAPORATION || pheromoneMatrix->mappedData ||
+		pheromoneMatrix->width != header.width || pheromoneMatrix->height != header.height)
+	{
+		delete pheromoneMatrix;
+		pheromoneMatrix = new PheromoneMatrix(header.width, header.height, INTERLEAVED_RGBA, EAGER_EVAPORATION);
+	}
+
+	if(pheromoneReader.readFrame(frame, pheromoneMatrix->data)) shownPheromoneFrame = frame;
+	else fprintf(stderr, "could not rebuild frame %d of the pheromone series\n", frame);
+}
+
+void TrajectoryPlayer::loaderLoop()
+{
+	unique_lock<mutex> lock(cacheMutex);
+
+	while(!stopping)
+	{
+		// The chunk being shown first, then the ones playback reaches next
+		int next = -1;
+		for(int k = 0; k <= REPLAY_READ_AHEAD_CHUNKS && next < 0; k++)
+		{
+			int chunk = wantedChunk + k * direction;
+			if(chunk < 0 || chunk >= (int)reader.index.size()) break;
+
+			bool cached = false;
+			for(shared_ptr<TrajectoryChunk>& entry : cache) cached = cached || entry->chunk == chunk;
+			if(!cached) next = chunk;
+		}
+
+		if(next < 0)
+		{
+			wake.wait(lock);
+			continue;
+		}
+
+		lock.unlock();
+		shared_ptr<TrajectoryChunk> decoded = decode(next);
+		lock.lock();
+
+		// Chunks playback has left go, the previous one stays for a step back.
+		// showFrame may still hold one, the shared pointer keeps it alive.
+		cache.erase(remove_if(cache.begin(), cache.end(), [&](const shared_ptr<TrajectoryChunk>& entry)
+		{
+			int ahead = (entry->chunk - wantedChunk) * direction;
+			return ahead < -1 || ahead > REPLAY_READ_AHEAD_CHUNKS;
+		}), cache.end());
+		cache.push_back(decoded);
+	}
+}
+
+shared_ptr<TrajectoryChunk> TrajectoryPlayer::decode(int chunk)
+{
+	TRACE_SCOPE("TrajectoryPlayer::decode");
+
+	shared_ptr<TrajectoryChunk> decoded = make_shared<TrajectoryChunk>();
+	decoded->chunk = chunk;
+
+	if(!reader.readChunk(chunk, decoded->frames, decoded->columns, (1u << TRAJECTORY_COLUMNS) - 1, decodePool))
+	{
+		fprintf(stderr, "could not decode chunk %d of the trajectory\n", chunk);
+		decoded->frames.clear();
+		return decoded;
+	}
+
+	size_t begin = 0;
+	for(TrajectoryFrame& frame : decoded->frames)
+	{
+		decoded->frameBegin.push_back(begin);
+		begin += frame.numberOfAnts;
+	}
+	return decoded;
+}
@@ -0,0 +1,372 @@
+#include <trajectoryRecorder.h>
+#include <trace.h>
+#include <varint.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+// Column arrays of the storage in use, in TrajectoryColumn order
+static void antColumns(AntSwarm* ants, const uint8_t* columns[TRAJECTORY_COLUMNS])
+{
+	if(ants->storage == FLOAT_ANTS)
+	{
+		columns[TRAJECTORY_POS_X] = (const uint8_t*)ants->posX;
+		columns[TRAJECTORY_POS_Y] = (const uint8_t*)ants->posY;
+		columns[TRAJECTORY_HEADING] = (const uint8_t*)ants->theta;
+		columns[TRAJECTORY_STATE] = ants->state;
+	}
+	else
+	{
+		columns[TRAJECTORY_POS_X] = (const uint8_t*)ants->fixedX;
+		columns[TRAJECTORY_POS_Y] = (const uint8_t*)ants->fixedY;
+		columns[TRAJECTORY_HEADING] = (const uint8_t*)ants->heading;
+		columns[TRAJECTORY_STATE] = ants->flags;
+	}
+}
+
+static inline void flushZeroRun(vector<uint8_t>& stream, uint64_t& zeroRun)
+{
+	if(zeroRun == 0) return;
+	putVarint(stream, 0);
+	putVarint(stream, zeroRun - 1);
+	zeroRun = 0;
+}
+
+// Values of n ants against the first previousAnts values of the previous frame
+template <typename T>
+static void encodeColumn(const T* values, const T* previous, int previousAnts, int n, vector<uint8_t>& stream, uint64_t& zeroRun)
+{
+	typedef typename make_signed<T>::type Signed;
+
+	for(int i = 0; i < n; i++)
+	{
+		T base = i < previousAnts ? previous[i] : 0;
+		int64_t delta = (Signed)(T)(values[i] - base);
+		if(delta == 0)
+		{
+			zeroRun++;
+			continue;
+		}
+		flushZeroRun(stream, zeroRun);
+		putVarint(stream, ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+	}
+}
+
+template <typename T>
+static bool decodeColumn(const uint8_t* cursor, const uint8_t* end, const vector<TrajectoryFrame>& frames, vector<uint8_t>& column)
+{
+	size_t values = 0;
+	for(const TrajectoryFrame& frame : frames) values += frame.numberOfAnts;
+	column.resize(values * sizeof(T));
+
+	T* out = (T*)column.data();
+	const T* previous = NULL;
+	int previousAnts = 0;
+	uint64_t zeroRun = 0;
+
+	for(const TrajectoryFrame& frame : frames)
+	{
+		for(int i = 0; i < frame.numberOfAnts; i++)
+		{
+			uint64_t coded = 0;
+			if(zeroRun > 0) zeroRun--;
+			else
+			{
+				if(!getVarint(cursor, end, coded)) return false;
+				if(coded == 0 && !getVarint(cursor, end, zeroRun)) return false;
+			}
+			int64_t delta = (int64_t)(coded >> 1) ^ -(int64_t)(coded & 1);
+			out[i] = (T)((i < previousAnts ? previous[i] : 0) + (T)delta);
+		}
+		previous = out;
+		previousAnts = frame.numberOfAnts;
+		out += frame.numberOfAnts;
+	}
+
+	return zeroRun == 0 && cursor == end;
+}
+
+TrajectoryRecorder::TrajectoryRecorder(const char* path, AntStorage antStorage, int newInterval, TrajectoryPolicy newPolicy)
+{
+	policy = newPolicy;
+	interval = max(newInterval, 1);
+	throttle = 1;
+	framesRecorded = 0;
+	framesDropped = 0;
+	previousAnts = 0;
+	for(int c = 0; c < TRAJECTORY_COLUMNS; c++) zeroRuns[c] = 0;
+
+	head.store(0);
+	tail.store(0);
+	stopping.store(false);
+	for(int s = 0; s < TRAJECTORY_RING_FRAMES; s++)
+	{
+		slots[s].numberOfAnts = 0;
+		slots[s].capacity = 0;
+		for(int c = 0; c < TRAJECTORY_COLUMNS; c++) slots[s].columns[c] = NULL;
+	}
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, TRAJECTORY_MAGIC, sizeof(header.magic));
+	header.version = TRAJECTORY_VERSION;
+	header.antStorage = antStorage;
+	header.interval = interval;
+	header.valueBytes[TRAJECTORY_POS_X] = antStorage == FLOAT_ANTS ? sizeof(float) : sizeof(uint16_t);
+	header.valueBytes[TRAJECTORY_POS_Y] = header.valueBytes[TRAJECTORY_POS_X];
+	header.valueBytes[TRAJECTORY_HEADING] = header.valueBytes[TRAJECTORY_POS_X];
+	header.valueBytes[TRAJECTORY_STATE] = sizeof(uint8_t);
+
+	file = fopen(path, "wb");
+	if(file == NULL || fwrite(&header, sizeof(header), 1, file) != 1)
+	{
+		fprintf(stderr, "could not write the trajectory to %s\n", path);
+		if(file != NULL) fclose(file);
+		file = NULL;
+		return;
+	}
+
+	writer = thread(&TrajectoryRecorder::writerLoop, this);
+}
+
+TrajectoryRecorder::~TrajectoryRecorder()
+{
+	close();
+	for(int s = 0; s < TRAJECTORY_RING_FRAMES; s++)
+		for(int c = 0; c < TRAJECTORY_COLUMNS; c++) free(slots[s].columns[c]);
+}
+
+bool TrajectoryRecorder::isOpen()
+{
+	return file != NULL;
+}
+
+void TrajectoryRecorder::record(AntSwarm* ants, uint64_t tick)
+{
+	if(file == NULL || tick % ((uint64_t)interval * throttle) != 0) return;
+
+	TRACE_SCOPE("TrajectoryRecorder::record");
+
+	uint64_t position = head.load(memory_order_relaxed);
+	uint64_t consumed = tail.load(memory_order_acquire);
+
+	if(position - consumed == TRAJECTORY_RING_FRAMES)
+	{
+		framesDropped++;
+		if(policy == THROTTLE_FRAMES) throttle = min(throttle * 2, TRAJECTORY_MAX_THROTTLE);
+		return;
+	}
+	if(policy == THROTTLE_FRAMES && position == consumed && throttle > 1) throttle /= 2;
+
+	// The slot is free, the writer does not touch it until head moves past it
+	TrajectorySlot* slot = &slots[position % TRAJECTORY_RING_FRAMES];
+	if(slot->capacity < ants->numberOfAnts)
+	{
+		for(int c = 0; c < TRAJECTORY_COLUMNS; c++)
+		{
+			free(slot->columns[c]);
+			slot->columns[c] = (uint8_t*)malloc((size_t)ants->capacity * header.valueBytes[c]);
+		}
+		slot->capacity = ants->capacity;
+	}
+
+	const uint8_t* columns[TRAJECTORY_COLUMNS];
+	antColumns(ants, columns);
+	for(int c = 0; c < TRAJECTORY_COLUMNS; c++) memcpy(slot->columns[c], columns[c], (size_t)ants->numberOfAnts * header.valueBytes[c]);
+	slot->tick = tick;
+	slot->numberOfAnts = ants->numberOfAnts;
+
+	head.store(position + 1, memory_order_release);
+	wake.notify_one();
+	framesRecorded++;
+}
+
+void TrajectoryRecorder::close()
+{
+	if(file == NULL) return;
+
+	stopping.store(true, memory_order_release);
+	wake.notify_one();
+	writer.join();
+
+	if(!chunkFrames.empty()) writeChunk();
+
+	TrajectoryFooter footer;
+	footer.indexOffset = ftello(file);
+	footer.numberOfChunks = index.size();
+	memcpy(footer.magic, TRAJECTORY_MAGIC, sizeof(footer.magic));
+
+	if(!index.empty()) fwrite(index.data(), sizeof(TrajectoryIndexEntry), index.size(), file);
+	fwrite(&footer, sizeof(footer), 1, file);
+	fclose(file);
+	file = NULL;
+}
+
+void TrajectoryRecorder::writerLoop()
+{
+	while(true)
+	{
+		uint64_t position = tail.load(memory_order_relaxed);
+
+		if(position == head.load(memory_order_acquire))
+		{
+			// The last frame is in the ring before stopping is set
+			if(stopping.load(memory_order_acquire) && position == head.load(memory_order_acquire)) break;
+
+			// A notify missed between the check and the wait costs at most the timeout
+			unique_lock<mutex> lock(wakeMutex);
+			wake.wait_for(lock, chrono::milliseconds(5));
+			continue;
+		}
+
+		encodeFrame(&slots[position % TRAJECTORY_RING_FRAMES]);
+		tail.store(position + 1, memory_order_release);
+
+		if(chunkFrames.size() == TRAJECTORY_FRAMES_PER_CHUNK) writeChunk();
+	}
+}
+
+void TrajectoryRecorder::encodeFrame(TrajectorySlot* slot)
+{
+	TRACE_SCOPE("TrajectoryRecorder::encodeFrame");
+
+	chunkFrames.push_back({slot->tick, slot->numberOfAnts, 0});
+
+	for(int c = 0; c < TRAJECTORY_COLUMNS; c++)
+	{
+		// The zero run of a column goes on from one frame to the next
+		uint64_t& zeroRun = zeroRuns[c];
+		const uint8_t* values = slot->columns[c];
+		const uint8_t* base = previous[c].data();
+
+		if(header.valueBytes[c] == 4) encodeColumn((const uint32_t*)values, (const uint32_t*)base, previousAnts, slot->numberOfAnts, streams[c], zeroRun);
+		else if(header.valueBytes[c] == 2) encodeColumn((const uint16_t*)values, (const uint16_t*)base, previousAnts, slot->numberOfAnts, streams[c], zeroRun);
+		else encodeColumn(values, base, previousAnts, slot->numberOfAnts, streams[c], zeroRun);
+
+		previous[c].assign(values, values + (size_t)slot->numberOfAnts * header.valueBytes[c]);
+	}
+	previousAnts = slot->numberOfAnts;
+}
+
+void TrajectoryRecorder::writeChunk()
+{
+	TRACE_SCOPE("TrajectoryRecorder::writeChunk");
+
+	TrajectoryChunkHeader chunkHeader;
+	memset(&chunkHeader, 0, sizeof(chunkHeader));
+	chunkHeader.numberOfFrames = chunkFrames.size();
+	for(int c = 0; c < TRAJECTORY_COLUMNS; c++)
+	{
+		flushZeroRun(streams[c], zeroRuns[c]);
+		chunkHeader.columnBytes[c] = streams[c].size();
+	}
+
+	index.push_back({chunkFrames.front().tick, chunkFrames.back().tick, (uint64_t)ftello(file)});
+
+	fwrite(&chunkHeader, sizeof(chunkHeader), 1, file);
+	fwrite(chunkFrames.data(), sizeof(TrajectoryFrame), chunkFrames.size(), file);
+	for(int c = 0; c < TRAJECTORY_COLUMNS; c++)
+	{
+		if(!streams[c].empty()) fwrite(streams[c].data(), 1, streams[c].size(), file);
+		streams[c].clear();
+	}
+
+	// The next chunk starts from a key frame
+	chunkFrames.clear();
+	previousAnts = 0;
+}
+
+TrajectoryReader::TrajectoryReader()
+{
+	file = NULL;
+}
+
+TrajectoryReader::~TrajectoryReader()
+{
+	if(file != NULL) fclose(file);
+}
+
+bool TrajectoryReader::open(const char* path)
+{
+	if(file != NULL) fclose(file);
+	index.clear();
+
+	file = fopen(path, "rb");
+	if(file == NULL) return false;
+
+	TrajectoryFooter footer;
+	bool valid = fread(&header, sizeof(header), 1, file) == 1 && memcmp(header.magic, TRAJECTORY_MAGIC, sizeof(header.magic)) == 0 && header.version == TRAJECTORY_VERSION;
+	valid = valid && fseeko(file, -(off_t)sizeof(footer), SEEK_END) == 0 && fread(&footer, sizeof(footer), 1, file) == 1;
+	valid = valid && memcmp(footer.magic, TRAJECTORY_MAGIC, sizeof(footer.magic)) == 0;
+
+	if(valid)
+	{
+		index.resize(footer.numberOfChunks);
+		valid = fseeko(file, footer.indexOffset, SEEK_SET) == 0 && (index.empty() || fread(index.data(), sizeof(TrajectoryIndexEntry), index.size(), file) == index.size());
+	}
+
+	if(!valid)
+	{
+		fprintf(stderr, "%s is not a complete trajectory\n", path);
+		fclose(file);
+		file = NULL;
+		index.clear();
+	}
+	return valid;
+}
+
+int TrajectoryReader::findChunk(uint64_t tick)
+{
+	int chunk = lower_bound(index.begin(), index.end(), tick, [](const TrajectoryIndexEntry& entry, uint64_t value) { return entry.lastTick < value; }) - index.begin();
+	return chunk < (int)index.size() ? chunk : -1;
+}
+
+bool TrajectoryReader::readChunk(int chunk, vector<TrajectoryFrame>& frames, vector<uint8_t> columns[TRAJECTORY_COLUMNS], unsigned columnMask, ThreadPool* threadPool)
+{
+	if(file == NULL || chunk < 0 || chunk >= (int)index.size()) return false;
+
+	TrajectoryChunkHeader chunkHeader;
+	if(fseeko(file, index[chunk].offset, SEEK_SET) != 0 || fread(&chunkHeader, sizeof(chunkHeader), 1, file) != 1) return false;
+	if(chunkHeader.numberOfFrames < 0 || chunkHeader.numberOfFrames > TRAJECTORY_FRAMES_PER_CHUNK) return false;
+
+	frames.resize(chunkHeader.numberOfFrames);
+	if(!frames.empty() && fread(frames.data(), sizeof(TrajectoryFrame), frames.size(), file) != frames.size()) return false;
+
+	vector<uint8_t> streams[TRAJECTORY_COLUMNS];
+	for(int c = 0; c < TRAJECTORY_COLUMNS; c++)
+	{
+		if(!(columnMask & (1u << c)))
+		{
+			if(fseeko(file, chunkHeader.columnBytes[c], SEEK_CUR) != 0) return false;
+			continue;
+		}
+
+		streams[c].resize(chunkHeader.columnBytes[c]);
+		if(!streams[c].empty() && fread(streams[c].data(), 1, streams[c].size(), file) != streams[c].size()) return false;
+	}
+
+	// The streams are independent, one column per thread
+	bool decoded[TRAJECTORY_COLUMNS];
+	auto decodeColumns = [&](int begin, int end, int threadIndex)
+	{
+		for(int c = begin; c < end; c++)
+		{
+			decoded[c] = true;
+			if(!(columnMask & (1u << c))) continue;
+
+			const uint8_t* first = streams[c].data();
+			const uint8_t* last = first + streams[c].size();
+			if(header.valueBytes[c] == 4) decoded[c] = decodeColumn<uint32_t>(first, last, frames, columns[c]);
+			else if(header.valueBytes[c] == 2) decoded[c] = decodeColumn<uint16_t>(first, last, frames, columns[c]);
+			else decoded[c] = decodeColumn<uint8_t>(first, last, frames, columns[c]);
+		}
+	};
+	if(threadPool != NULL) threadPool->parallelFor(0, TRAJECTORY_COLUMNS, 1, decodeColumns);
+	else decodeColumns(0, TRAJECTORY_COLUMNS, 0);
+
+	for(int c = 0; c < TRAJECTORY_COLUMNS; c++)
+		if(!decoded[c]) return false;
+	return true;
+}
@@ -0,0 +1,53 @@
+#include <sinCosLookup.h>
+
+// Sin and cos in double of |x| <= pi/4, the Taylor series has converged to
+// double precision by the 11th term
+static constexpr double taylorSine(double x)
+{
+	double term = x, sum = x;
+	for(int n = 1; n <= 11; n++)
+	{
+		term *= -x * x / ((2*n) * (2*n + 1));
+		sum += term;
+	}
+	return sum;
+}
+
+static constexpr double taylorCosine(double x)
+{
+	double term = 1.0, sum = 1.0;
+	for(int n = 1; n <= 11; n++)
+	{
+		term *= -x * x / ((2*n - 1) * (2*n));
+		sum += term;
+	}
+	return sum;
+}
+
+static constexpr TrigTables generateTrigTables()
+{
+	TrigTables tables = {};
+
+	// Step i sits i/TRIG_TABLE_STEPS of a turn in, quadrant (4i + N/2) / N
+	// brings it within an eighth of a turn of a multiple of pi/2
+	for(int i = 0; i < TRIG_TABLE_STEPS; i++)
+	{
+		long long quadrant = (4LL * i + TRIG_TABLE_STEPS / 2) / TRIG_TABLE_STEPS;
+		double x = (4.0 * i / TRIG_TABLE_STEPS - quadrant) * (M_PI / 2);
+		double s = taylorSine(x), c = taylorCosine(x);
+
+		switch(quadrant & 3)
+		{
+			case 0: tables.sine[i] = s; tables.cosine[i] = c; break;
+			case 1: tables.sine[i] = c; tables.cosine[i] = -s; break;
+			case 2: tables.sine[i] = -s; tables.cosine[i] = -c; break;
+			case 3: tables.sine[i] = -c; tables.cosine[i] = s; break;
+		}
+	}
+
+	return tables;
+}
+
+static_assert(TRIG_TABLE_STEPS >= 4 && TRIG_TABLE_STEPS <= 65536, "compact ants keep the heading step in 16 bits");
+
+alignas(64) constexpr TrigTables trigTables = generateTrigTables();
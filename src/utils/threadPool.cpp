@@ -0,0 +1,144 @@
+#include <threadPool.h>
+#include <trace.h>
+#include <algorithm>
+
+ThreadPool::ThreadPool(int newNumberOfThreads)
+{
+	numberOfThreads = newNumberOfThreads > 0 ? newNumberOfThreads : defaultNumberOfThreads();
+
+	jobGeneration = 0;
+	runningWorkers = 0;
+	stopping = false;
+	jobBody = NULL;
+
+	queues = vector<ChunkQueue>(numberOfThreads);
+
+	for(int t = 1; t < numberOfThreads; t++)
+		workers.push_back(thread(&ThreadPool::workerLoop, this, t));
+}
+
+ThreadPool::~ThreadPool()
+{
+	{
+		lock_guard<mutex> lock(jobMutex);
+		stopping = true;
+	}
+	jobStart.notify_all();
+
+	for(int t = 0; t < (int)workers.size(); t++) workers[t].join();
+}
+
+int ThreadPool::defaultNumberOfThreads()
+{
+	int hardwareThreads = (int)thread::hardware_concurrency();
+	return hardwareThreads > 0 ? hardwareThreads : 1;
+}
+
+void ThreadPool::parallelFor(int begin, int end, int chunkSize, const ParallelForBody& body)
+{
+	if(end <= begin) return;
+
+	int numberOfChunks = (end - begin + chunkSize - 1) / chunkSize;
+
+	if(numberOfThreads == 1 || numberOfChunks == 1)
+	{
+		body(begin, end, 0);
+		return;
+	}
+
+	// Contiguous chunk ranges per thread keep neighbouring ants on the same core,
+	// stealing only kicks in when one range turns out to be more expensive
+	for(int t = 0; t < numberOfThreads; t++)
+	{
+		uint64_t front = (uint64_t)numberOfChunks * t / numberOfThreads;
+		uint64_t back = (uint64_t)numberOfChunks * (t + 1) / numberOfThreads;
+		queues[t].frontBack.store((front << 32) | back, memory_order_relaxed);
+	}
+
+	{
+		lock_guard<mutex> lock(jobMutex);
+		jobBody = &body;
+		jobBegin = begin;
+		jobEnd = end;
+		jobChunkSize = chunkSize;
+		runningWorkers = (int)workers.size();
+		jobGeneration++;
+	}
+	jobStart.notify_all();
+
+	runChunks(0);
+
+	unique_lock<mutex> lock(jobMutex);
+	jobDone.wait(lock, [this]{ return runningWorkers == 0; });
+	jobBody = NULL;
+}
+
+void ThreadPool::workerLoop(int threadIndex)
+{
+	unsigned long seenGeneration = 0;
+
+	while(true)
+	{
+		{
+			unique_lock<mutex> lock(jobMutex);
+			jobStart.wait(lock, [&]{ return stopping || jobGeneration != seenGeneration; });
+			if(stopping) return;
+			seenGeneration = jobGeneration;
+		}
+
+		runChunks(threadIndex);
+
+		{
+			lock_guard<mutex> lock(jobMutex);
+			runningWorkers--;
+			if(runningWorkers == 0) jobDone.notify_one();
+		}
+	}
+}
+
+void ThreadPool::runChunks(int threadIndex)
+{
+	// One event per thread and job, shows how evenly the range was split
+	TRACE_SCOPE("ThreadPool::runChunks");
+
+	int chunk;
+
+	while(popChunk(threadIndex, false, &chunk))
+	{
+		int chunkBegin = jobBegin + chunk * jobChunkSize;
+		(*jobBody)(chunkBegin, min(chunkBegin + jobChunkSize, jobEnd), threadIndex);
+	}
+
+	for(int v = 1; v < numberOfThreads; v++)
+	{
+		int victim = (threadIndex + v) % numberOfThreads;
+
+		while(popChunk(victim, true, &chunk))
+		{
+			int chunkBegin = jobBegin + chunk * jobChunkSize;
+			(*jobBody)(chunkBegin, min(chunkBegin + jobChunkSize, jobEnd), threadIndex);
+		}
+	}
+}
+
+bool ThreadPool::popChunk(int queueIndex, bool steal, int* chunk)
+{
+	atomic<uint64_t>& frontBack = queues[queueIndex].frontBack;
+	uint64_t current = frontBack.load(memory_order_acquire);
+
+	while(true)
+	{
+		uint64_t front = current >> 32;
+		uint64_t back = current & 0xffffffffu;
+
+		if(front >= back) return false;
+
+		uint64_t next = steal ? ((front << 32) | (back - 1)) : (((front + 1) << 32) | back);
+
+		if(frontBack.compare_exchange_weak(current, next, memory_order_acq_rel, memory_order_acquire))
+		{
+			*chunk = (int)(steal ? back - 1 : front);
+			return true;
+		}
+	}
+}
@@ -0,0 +1,88 @@
+#include <trace.h>
+
+#ifdef SWARM_TRACE
+
+#include <algorithm>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+typedef struct
+{
+	int threadIndex;
+	uint64_t recorded;
+	vector<TraceEvent> events;
+}TraceBuffer;
+
+// Buffers are registered once per thread and never freed, so the events of a
+// thread that already exited can still be written
+static mutex traceMutex;
+static vector<TraceBuffer*> traceBuffers;
+static thread_local TraceBuffer* traceBuffer = NULL;
+
+void traceRecord(const char* name, uint64_t start, uint64_t end)
+{
+	if(traceBuffer == NULL)
+	{
+		TraceBuffer* buffer = new TraceBuffer;
+		buffer->recorded = 0;
+		buffer->events.resize(TRACE_EVENTS_PER_THREAD);
+
+		lock_guard<mutex> lock(traceMutex);
+		buffer->threadIndex = traceBuffers.size();
+		traceBuffers.push_back(buffer);
+		traceBuffer = buffer;
+	}
+
+	TraceEvent& event = traceBuffer->events[traceBuffer->recorded % TRACE_EVENTS_PER_THREAD];
+	event.name = name;
+	event.start = start;
+	event.duration = end - start;
+	traceBuffer->recorded++;
+}
+
+void traceWrite(const char* path)
+{
+	lock_guard<mutex> lock(traceMutex);
+
+	FILE* file = fopen(path, "w");
+	if(file == NULL)
+	{
+		fprintf(stderr, "could not write the trace to %s\n", path);
+		return;
+	}
+
+	// Timestamps start at the oldest event kept
+	uint64_t origin = UINT64_MAX;
+	for(TraceBuffer* buffer : traceBuffers)
+	{
+		uint64_t kept = min(buffer->recorded, (uint64_t)TRACE_EVENTS_PER_THREAD);
+		for(uint64_t i = buffer->recorded - kept; i < buffer->recorded; i++)
+			origin = min(origin, buffer->events[i % TRACE_EVENTS_PER_THREAD].start);
+	}
+
+	fprintf(file, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+	bool first = true;
+
+	for(TraceBuffer* buffer : traceBuffers)
+	{
+		fprintf(file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"thread %d\"}}",
+			first ? "" : ",\n", buffer->threadIndex, buffer->threadIndex);
+		first = false;
+
+		uint64_t kept = min(buffer->recorded, (uint64_t)TRACE_EVENTS_PER_THREAD);
+		for(uint64_t i = buffer->recorded - kept; i < buffer->recorded; i++)
+		{
+			TraceEvent& event = buffer->events[i % TRACE_EVENTS_PER_THREAD];
+			fprintf(file, ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+				event.name, buffer->threadIndex, (event.start - origin) * 1e-3, event.duration * 1e-3);
+		}
+	}
+
+	fprintf(file, "\n]}\n");
+	fclose(file);
+}
+
+#endif